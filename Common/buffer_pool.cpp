@@ -0,0 +1,202 @@
+/**********************************************************************
+**	SOURCE FILE:	buffer_pool.cpp - Pool of output buffers
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      BufferPool();
+**      void acquire(std::vector<char> &);
+**      void resized(size_t, size_t);
+**      void release(std::vector<char> &);
+**      size_t getMemoryUsage();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Lends output buffers to the connections that have something queued,
+** so an idle connection holds no buffer at all. A buffer comes back
+** as soon as its queue has been written out and is handed to the
+** next connection that falls behind, without going through malloc.
+**
+** The pool also keeps count of every byte of buffer storage it has
+** lent out or is holding, for the per-client memory report.
+*************************************************************************/
+#include "buffer_pool.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: BufferPool
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			BufferPool()
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Base constructor for an empty pool.
+*********************************************************************/
+BufferPool::BufferPool()
+{
+    usedBytes = 0;
+    spareBytes = 0;
+}
+
+
+/*****************************************************************
+** Function: acquire
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void acquire(std::vector<char> &buffer)
+**          std::vector<char> &buffer -- empty buffer with no storage
+**
+** Returns:
+**			void
+**
+** Notes:
+** Gives the buffer the storage of an idle one, if there is one;
+** otherwise it allocates as it grows.
+*********************************************************************/
+void BufferPool::acquire(vector<char> &buffer)
+{
+    if (freeBuffers.empty())
+    {
+        return;
+    }
+
+    buffer.swap(freeBuffers.back());
+    freeBuffers.pop_back();
+
+    spareBytes -= buffer.capacity();
+    usedBytes += buffer.capacity();
+}
+
+
+/*****************************************************************
+** Function: resized
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void resized(size_t before, size_t after)
+**          size_t before -- capacity of a lent buffer before it grew
+**          size_t after -- its capacity now
+**
+** Returns:
+**			void
+**
+** Notes:
+** Keeps the count right when a lent buffer reallocates.
+*********************************************************************/
+void BufferPool::resized(size_t before, size_t after)
+{
+    usedBytes += after - before;
+}
+
+
+/*****************************************************************
+** Function: release
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void release(std::vector<char> &buffer)
+**          std::vector<char> &buffer -- buffer whose output is all sent
+**
+** Returns:
+**			void
+**
+** Notes:
+** Takes the buffer's storage back, leaving it with none. Storage is
+** kept for reuse unless the pool already holds BUFFER_POOL_MAX
+** buffers or this one grew past BUFFER_POOL_KEEP.
+*********************************************************************/
+void BufferPool::release(vector<char> &buffer)
+{
+    size_t capacity = buffer.capacity();
+
+    if (capacity == 0)
+    {
+        return;
+    }
+
+    usedBytes -= capacity;
+
+    if (freeBuffers.size() >= BUFFER_POOL_MAX || capacity > BUFFER_POOL_KEEP)
+    {
+        vector<char>().swap(buffer);
+        return;
+    }
+
+    buffer.clear();
+    freeBuffers.push_back(vector<char>());
+    freeBuffers.back().swap(buffer);
+    spareBytes += capacity;
+}
+
+
+/*****************************************************************
+** Function: getMemoryUsage
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			size_t getMemoryUsage()
+**
+** Returns:
+**			size_t -- bytes of buffer storage lent out or held idle
+**
+** Notes:
+** Counts the pool's own bookkeeping as well.
+*********************************************************************/
+size_t BufferPool::getMemoryUsage()
+{
+    return usedBytes + spareBytes + freeBuffers.capacity() * sizeof(vector<char>);
+}
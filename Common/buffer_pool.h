@@ -0,0 +1,36 @@
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <vector>
+#include <cstddef>
+
+//idle output buffers a worker keeps around for reuse
+#define BUFFER_POOL_MAX 64
+
+//buffers that grew past this are freed rather than kept
+#define BUFFER_POOL_KEEP 131072
+
+class BufferPool
+{
+    public:
+        /** Initializers **/
+        BufferPool();
+
+        /** Buffer management **/
+        void acquire(std::vector<char> &);
+        void resized(size_t, size_t);
+        void release(std::vector<char> &);
+
+        /** Accounting **/
+        size_t getMemoryUsage();
+
+    private:
+        //empty buffers that still hold their storage
+        std::vector<std::vector<char> > freeBuffers;
+
+        //storage held by buffers handed out, and by the idle ones
+        size_t usedBytes;
+        size_t spareBytes;
+};
+
+#endif //BUFFER_POOL_H
@@ -0,0 +1,24 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <iostream>
+
+//failed expectations in this test program
+static int checkFailures = 0;
+
+//reports a failed expectation and carries on with the test
+#define CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+            checkFailures++; \
+        } \
+    } while (0)
+
+//exit status for main: 0 when every check passed
+#define CHECK_RESULT(name) \
+    (std::cout << name << (checkFailures == 0 ? ": ok" : ": FAILED") << std::endl, checkFailures == 0 ? 0 : 1)
+
+#endif //CHECK_H
@@ -0,0 +1,326 @@
+/**********************************************************************
+**	SOURCE FILE:	config.cpp - Command line and config file settings
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+** int parseOptions(int, char *[], const char *, const struct option *, OptionHandler)
+** int loadConfigFile(const char *, const struct option *, OptionHandler)
+** int parseNumber(const char *, const char *, long, long, int *)
+** int parseFlag(const char *, const char *, bool *)
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Lets the servers take their tuning settings at startup instead of
+** from #defines. Each server lists its settings once as getopt_long
+** options and hands every value to a single handler, so a setting
+** can be given on the command line (-p 9000 or --port=9000) or as a
+** "port = 9000" line in the file named by -c, and is validated the
+** same way either way. The file is read first so the command line
+** overrides it. Switches are written as "name = yes" or "name = no"
+** in the file.
+*************************************************************************/
+#include <iostream>
+#include <cstring>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "config.h"
+
+using namespace std;
+
+/*****************************************************************
+** Function: parseOptions
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int parseOptions(int argc, char *argv[], const char *shortOptions,
+**                           const struct option *options, OptionHandler apply)
+**              int argc -- number of command line arguments
+**              char *argv[] -- command line arguments
+**              const char *shortOptions -- getopt option string
+**              const struct option *options -- long names of the options
+**              OptionHandler apply -- validates and stores one setting
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 on an unknown option or invalid value
+**
+** Notes:
+** Loads the config file given with -c, if any, then applies the rest
+** of the command line on top of it.
+**********************************************************************/
+int parseOptions(int argc, char *argv[], const char *shortOptions,
+                 const struct option *options, OptionHandler apply)
+{
+    int option;
+
+    //find the config file first so the command line wins
+    opterr = 0;
+    optind = 1;
+    while ((option = getopt_long(argc, argv, shortOptions, options, NULL)) != -1)
+    {
+        if (option == CONFIG_OPTION && loadConfigFile(optarg, options, apply) == -1)
+        {
+            return -1;
+        }
+    }
+
+    opterr = 1;
+    optind = 1;
+    while ((option = getopt_long(argc, argv, shortOptions, options, NULL)) != -1)
+    {
+        if (option == CONFIG_OPTION)
+        {
+            continue;
+        }
+
+        //getopt has already said what was wrong
+        if (option == '?' || option == ':')
+        {
+            return -1;
+        }
+
+        if (apply(option, optarg) == -1)
+        {
+            return -1;
+        }
+    }
+
+    if (optind < argc)
+    {
+        cerr << "Unexpected argument: " << argv[optind] << endl;
+        return -1;
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: loadConfigFile
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int loadConfigFile(const char *path, const struct option *options,
+**                             OptionHandler apply)
+**              const char *path -- config file to read
+**              const struct option *options -- long names of the options
+**              OptionHandler apply -- validates and stores one setting
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the file cannot be read or has a bad line
+**
+** Notes:
+** Reads "name = value" lines, where name is the long name of an
+** option. Blank lines and everything after a # are ignored.
+**********************************************************************/
+int loadConfigFile(const char *path, const struct option *options, OptionHandler apply)
+{
+    FILE *file = fopen(path, "r");
+    char line[CONFIG_LINE_LENGTH];
+    int lineNumber = 0;
+
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        lineNumber++;
+
+        //drop comments and the line ending
+        line[strcspn(line, "#\r\n")] = '\0';
+
+        char *name = line + strspn(line, " \t");
+        if (*name == '\0')
+        {
+            continue;
+        }
+
+        //split on the first '=' and trim both halves
+        char *value = strchr(name, '=');
+        if (value == NULL)
+        {
+            cerr << path << ":" << lineNumber << ": expected name = value" << endl;
+            fclose(file);
+            return -1;
+        }
+        *value++ = '\0';
+        value += strspn(value, " \t");
+
+        for (char *end = name + strlen(name); end > name && (end[-1] == ' ' || end[-1] == '\t'); end--)
+        {
+            end[-1] = '\0';
+        }
+        for (char *end = value + strlen(value); end > value && (end[-1] == ' ' || end[-1] == '\t'); end--)
+        {
+            end[-1] = '\0';
+        }
+
+        //look the name up among the long options
+        const struct option *match = NULL;
+        for (int i = 0; options[i].name != NULL; i++)
+        {
+            if (strcmp(options[i].name, name) == 0)
+            {
+                match = &options[i];
+                break;
+            }
+        }
+
+        if (match == NULL || match->val == CONFIG_OPTION)
+        {
+            cerr << path << ":" << lineNumber << ": unknown setting " << name << endl;
+            fclose(file);
+            return -1;
+        }
+
+        int result;
+        if (match->has_arg == no_argument)
+        {
+            //switches are only applied when turned on
+            bool enabled;
+            result = parseFlag(name, value, &enabled);
+            if (result == 0 && enabled)
+            {
+                result = apply(match->val, NULL);
+            }
+        }
+        else
+        {
+            result = apply(match->val, value);
+        }
+
+        if (result == -1)
+        {
+            cerr << path << ":" << lineNumber << ": invalid setting " << name << endl;
+            fclose(file);
+            return -1;
+        }
+    }
+
+    fclose(file);
+    return 0;
+}
+
+/*****************************************************************
+** Function: parseNumber
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int parseNumber(const char *name, const char *value, long min,
+**                          long max, int *result)
+**              const char *name -- setting being parsed, for errors
+**              const char *value -- text to parse
+**              long min -- smallest value allowed
+**              long max -- largest value allowed
+**              int *result -- receives the number
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the value is not a number in range
+**
+** Notes:
+** Unlike atoi, rejects trailing junk and out of range values.
+**********************************************************************/
+int parseNumber(const char *name, const char *value, long min, long max, int *result)
+{
+    char *end;
+
+    errno = 0;
+    long number = strtol(value, &end, 10);
+
+    if (*value == '\0' || *end != '\0' || errno != 0)
+    {
+        cerr << name << ": not a number: " << value << endl;
+        return -1;
+    }
+
+    if (number < min || number > max)
+    {
+        cerr << name << ": must be between " << min << " and " << max << endl;
+        return -1;
+    }
+
+    *result = (int) number;
+    return 0;
+}
+
+/*****************************************************************
+** Function: parseFlag
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int parseFlag(const char *name, const char *value, bool *result)
+**              const char *name -- setting being parsed, for errors
+**              const char *value -- yes/no, true/false, on/off or 1/0
+**              bool *result -- receives the switch setting
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the value is not a recognised switch
+**
+** Notes:
+** Parses the value of a switch in a config file.
+**********************************************************************/
+int parseFlag(const char *name, const char *value, bool *result)
+{
+    if (strcmp(value, "yes") == 0 || strcmp(value, "true") == 0 ||
+        strcmp(value, "on") == 0 || strcmp(value, "1") == 0)
+    {
+        *result = true;
+        return 0;
+    }
+
+    if (strcmp(value, "no") == 0 || strcmp(value, "false") == 0 ||
+        strcmp(value, "off") == 0 || strcmp(value, "0") == 0)
+    {
+        *result = false;
+        return 0;
+    }
+
+    cerr << name << ": expected yes or no, not " << value << endl;
+    return -1;
+}
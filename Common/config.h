@@ -0,0 +1,20 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <getopt.h>
+
+//option every server uses to name its config file
+#define CONFIG_OPTION 'c'
+
+//longest line accepted in a config file
+#define CONFIG_LINE_LENGTH 512
+
+/** Applies one setting; returns 0, or -1 if the value is invalid **/
+typedef int (*OptionHandler)(int, const char *);
+
+int parseOptions(int, char *[], const char *, const struct option *, OptionHandler);
+int loadConfigFile(const char *, const struct option *, OptionHandler);
+int parseNumber(const char *, const char *, long, long, int *);
+int parseFlag(const char *, const char *, bool *);
+
+#endif //CONFIG_H
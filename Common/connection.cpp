@@ -0,0 +1,693 @@
+/**********************************************************************
+**	SOURCE FILE:	connection.cpp - Per-client connection state
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      Connection();
+**      void open(int);
+**      int getSocketValue();
+**      unsigned int getEvents();
+**      void setEvents(unsigned int);
+**      bool isReadSuspended();
+**      void setReadSuspended(bool);
+**      int sendData(const char *, size_t);
+**      int flushOutput();
+**      size_t pendingOutput();
+**      void closeConnection();
+**      static size_t getBufferMemory();
+**      void attachPipe(int *, size_t);
+**      bool hasPipe();
+**      bool detachPipe(int *);
+**      TimerNode *getTimer();
+**      unsigned long long getLastActive();
+**      void touch(unsigned long long);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Holds what a worker's event loop needs to know about a single
+** client: its socket, the events registered for it and any output the
+** socket could not take yet. Output that does not fit in the kernel
+** send buffer is queued here and flushed once the socket is reported
+** writable.
+** In splice mode the unsent bytes stay in a pipe instead, which the
+** connection holds until it has been drained into the socket.
+** Each connection also carries its own timer node and the time it
+** last made progress, so deadlines never need a separate allocation.
+** It is the ClientChannel the worker's handler replies through; final,
+** so the engine's own calls on it are not virtual.
+**
+** A connection with nothing queued holds no output storage: it
+** borrows a buffer from its worker's BufferPool when the socket first
+** refuses bytes and returns it once they have all gone out. The fields
+** are laid out to fit the record in two cache lines.
+*************************************************************************/
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "connection.h"
+#include "buffer_pool.h"
+
+using namespace std;
+
+//output storage lent to this worker's connections
+static thread_local BufferPool outputBuffers;
+
+//the per-client cost -C documents
+static_assert(sizeof(Connection) <= 2 * CACHE_LINE_SIZE, "Connection record no longer fits two cache lines");
+
+
+/*****************************************************************
+** Function: Connection
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			Connection()
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Base constructor for an unused connection.
+*********************************************************************/
+Connection::Connection()
+{
+    open(-1);
+}
+
+
+/*****************************************************************
+** Function: open
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void open(int sockVal)
+**          int sockVal -- newly accepted client socket
+**
+** Returns:
+**			void
+**
+** Notes:
+** Resets the connection state for a newly accepted client.
+*********************************************************************/
+void Connection::open(int sockVal)
+{
+    sock = sockVal;
+    events = 0;
+    readSuspended = false;
+    outBuffer.clear();
+    outStart = 0;
+    pipeFds[0] = pipeFds[1] = -1;
+    pipeBytes = 0;
+    timer.next = timer.prev = NULL;
+    timer.owner = this;
+    lastActive = 0;
+    handlerState = NULL;
+}
+
+
+/*****************************************************************
+** Function: getSocketValue
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int getSocketValue()
+**
+** Returns:
+**			int -- the client's socket descriptor
+**
+** Notes:
+** Getter for the client socket.
+*********************************************************************/
+int Connection::getSocketValue()
+{
+    return sock;
+}
+
+
+/*****************************************************************
+** Function: getEvents
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			unsigned int getEvents()
+**
+** Returns:
+**			unsigned int -- events registered with the event engine
+**
+** Notes:
+** Getter for the registered events.
+*********************************************************************/
+unsigned int Connection::getEvents()
+{
+    return events;
+}
+
+
+/*****************************************************************
+** Function: setEvents
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void setEvents(unsigned int newEvents)
+**          unsigned int newEvents -- events now registered with the
+**                                    event engine
+**
+** Returns:
+**			void
+**
+** Notes:
+** Setter for the registered events.
+*********************************************************************/
+void Connection::setEvents(unsigned int newEvents)
+{
+    events = newEvents;
+}
+
+
+/*****************************************************************
+** Function: isReadSuspended
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			bool isReadSuspended()
+**
+** Returns:
+**			bool -- true while reads are paused for backpressure
+**
+** Notes:
+** Getter for the read suspension flag.
+*********************************************************************/
+bool Connection::isReadSuspended()
+{
+    return readSuspended;
+}
+
+
+/*****************************************************************
+** Function: setReadSuspended
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void setReadSuspended(bool suspended)
+**          bool suspended -- true to pause reading from the client
+**
+** Returns:
+**			void
+**
+** Notes:
+** Setter for the read suspension flag.
+*********************************************************************/
+void Connection::setReadSuspended(bool suspended)
+{
+    readSuspended = suspended;
+}
+
+
+/*****************************************************************
+** Function: sendData
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int sendData(const char *data, size_t length)
+**          const char *data -- bytes to send
+**          size_t length -- number of bytes to send
+**
+** Returns:
+**			int -- 0 if the data was sent or queued
+**              -- -1 if the connection has failed
+**
+** Notes:
+** Sends straight to the socket when nothing is queued ahead of the
+** data, and queues whatever the socket could not take.
+*********************************************************************/
+int Connection::sendData(const char *data, size_t length)
+{
+    size_t sent = 0;
+
+    //only write directly if it will not overtake queued bytes
+    if (pendingOutput() == 0)
+    {
+        while (sent < length)
+        {
+            ssize_t n = send(sock, data + sent, length - sent, MSG_NOSIGNAL);
+
+            if (n < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                {
+                    break;
+                }
+                return -1;
+            }
+            sent += n;
+        }
+    }
+
+    //queue the remainder until the socket is writable
+    if (sent < length)
+    {
+        if (outBuffer.capacity() == 0)
+        {
+            outputBuffers.acquire(outBuffer);
+        }
+        size_t capacity = outBuffer.capacity();
+
+        //reclaim the already sent front of the buffer
+        if (outStart > 0 && outStart >= outBuffer.size() / 2)
+        {
+            outBuffer.erase(outBuffer.begin(), outBuffer.begin() + outStart);
+            outStart = 0;
+        }
+        outBuffer.insert(outBuffer.end(), data + sent, data + length);
+
+        if (outBuffer.capacity() != capacity)
+        {
+            outputBuffers.resized(capacity, outBuffer.capacity());
+        }
+    }
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: flushOutput
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int flushOutput()
+**
+** Returns:
+**			int -- 0 if the socket took what it could
+**              -- -1 if the connection has failed
+**
+** Notes:
+** Writes queued output until it is gone or the socket is full, then
+** splices out whatever is left in the connection's pipe.
+*********************************************************************/
+int Connection::flushOutput()
+{
+    while (outBuffer.size() > outStart)
+    {
+        ssize_t n = send(sock, &outBuffer[outStart], outBuffer.size() - outStart, MSG_NOSIGNAL);
+
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return 0;
+            }
+            return -1;
+        }
+        outStart += n;
+    }
+
+    //everything went out; the storage goes back to the pool
+    outputBuffers.release(outBuffer);
+    outStart = 0;
+
+    //bytes left behind by the splice echo path
+    while (pipeBytes > 0)
+    {
+        ssize_t n = splice(pipeFds[0], NULL, sock, NULL, pipeBytes, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return 0;
+            }
+            return -1;
+        }
+        pipeBytes -= n;
+    }
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: pendingOutput
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			size_t pendingOutput()
+**
+** Returns:
+**			size_t -- number of bytes still waiting to be sent
+**
+** Notes:
+** Getter for the size of the output queue, including bytes held in
+** the connection's pipe.
+*********************************************************************/
+size_t Connection::pendingOutput()
+{
+    return outBuffer.size() - outStart + pipeBytes;
+}
+
+
+/*****************************************************************
+** Function: closeConnection
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void closeConnection()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Closes the client socket and drops any queued output, along with
+** the pipe holding it.
+*********************************************************************/
+void Connection::closeConnection()
+{
+    if (sock >= 0)
+    {
+        close(sock);
+    }
+    if (pipeFds[0] >= 0)
+    {
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+    }
+    outputBuffers.release(outBuffer);
+    open(-1);
+}
+
+
+/*****************************************************************
+** Function: getBufferMemory
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			static size_t getBufferMemory()
+**
+** Returns:
+**			size_t -- bytes of output storage this worker holds
+**
+** Notes:
+** Covers the buffers lent to connections and the idle ones pooled.
+*********************************************************************/
+size_t Connection::getBufferMemory()
+{
+    return outputBuffers.getMemoryUsage();
+}
+
+
+/*****************************************************************
+** Function: attachPipe
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void attachPipe(int *fds, size_t bytes)
+**          int *fds -- read and write ends of the pipe
+**          size_t bytes -- bytes in the pipe still owed to the client
+**
+** Returns:
+**			void
+**
+** Notes:
+** Hands the connection a pipe with unsent echo data in it. The
+** connection owns the pipe until detachPipe gives it back empty.
+*********************************************************************/
+void Connection::attachPipe(int *fds, size_t bytes)
+{
+    pipeFds[0] = fds[0];
+    pipeFds[1] = fds[1];
+    pipeBytes = bytes;
+}
+
+
+/*****************************************************************
+** Function: hasPipe
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			bool hasPipe()
+**
+** Returns:
+**			bool -- true if the connection holds a pipe
+**
+** Notes:
+** Getter for whether a pipe is attached.
+*********************************************************************/
+bool Connection::hasPipe()
+{
+    return pipeFds[0] >= 0;
+}
+
+
+/*****************************************************************
+** Function: detachPipe
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			bool detachPipe(int *fds)
+**          int *fds -- receives the read and write ends
+**
+** Returns:
+**			bool -- true if an empty pipe was handed back
+**
+** Notes:
+** Gives up the connection's pipe once everything in it has been
+** sent, so it can go back to the worker's pool.
+*********************************************************************/
+bool Connection::detachPipe(int *fds)
+{
+    if (!hasPipe() || pipeBytes > 0)
+    {
+        return false;
+    }
+
+    fds[0] = pipeFds[0];
+    fds[1] = pipeFds[1];
+    pipeFds[0] = pipeFds[1] = -1;
+    return true;
+}
+
+
+/*****************************************************************
+** Function: getTimer
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			TimerNode *getTimer()
+**
+** Returns:
+**			TimerNode * -- the connection's deadline timer
+**
+** Notes:
+** The timer's owner is always this connection. It must be cancelled
+** before the connection is reopened.
+*********************************************************************/
+TimerNode *Connection::getTimer()
+{
+    return &timer;
+}
+
+
+/*****************************************************************
+** Function: getLastActive
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			unsigned long long getLastActive()
+**
+** Returns:
+**			unsigned long long -- time of the last activity in ms
+**
+** Notes:
+** Getter for the last activity time.
+*********************************************************************/
+unsigned long long Connection::getLastActive()
+{
+    return lastActive;
+}
+
+
+/*****************************************************************
+** Function: touch
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void touch(unsigned long long now)
+**          unsigned long long now -- current time in milliseconds
+**
+** Returns:
+**			void
+**
+** Notes:
+** Records activity on the connection. The timer is left where it is;
+** the expiry handler pushes it back if the client was active since.
+*********************************************************************/
+void Connection::touch(unsigned long long now)
+{
+    lastActive = now;
+}
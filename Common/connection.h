@@ -0,0 +1,71 @@
+#ifndef CONNECTION_H
+#define CONNECTION_H
+
+#include <vector>
+#include <cstddef>
+#include "timer_wheel.h"
+#include "handler.h"
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
+
+class alignas(CACHE_LINE_SIZE) Connection final : public ClientChannel
+{
+    public:
+        /** Initializers **/
+        Connection();
+        void open(int);
+
+        /** Getters & Setters **/
+        int getSocketValue();
+        unsigned int getEvents();
+        void setEvents(unsigned int);
+        bool isReadSuspended();
+        void setReadSuspended(bool);
+
+        /** Output buffering **/
+        int sendData(const char *, size_t);
+        int flushOutput();
+        size_t pendingOutput();
+        void closeConnection();
+        static size_t getBufferMemory();
+
+        /** Splice output **/
+        void attachPipe(int *, size_t);
+        bool hasPipe();
+        bool detachPipe(int *);
+
+        /** Deadlines **/
+        TimerNode *getTimer();
+        unsigned long long getLastActive();
+        void touch(unsigned long long);
+
+    private:
+        //client socket
+        int sock;
+
+        //events currently registered with the event engine
+        unsigned int events;
+
+        //spliced bytes still in the pipe; never more than SPLICE_CHUNK,
+        //so it shares a word with the flags
+        unsigned int pipeBytes;
+
+        //reads are paused while the output queue is too full
+        bool readSuspended;
+
+        //bytes waiting for the socket to become writable; the storage
+        //is borrowed from the worker's BufferPool only while it is used
+        std::vector<char> outBuffer;
+        size_t outStart;
+
+        //pipe holding spliced bytes the socket could not take yet
+        int pipeFds[2];
+
+        //idle deadline, linked into the worker's timer wheel
+        TimerNode timer;
+        unsigned long long lastActive;
+};
+
+#endif //CONNECTION_H
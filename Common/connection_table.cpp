@@ -0,0 +1,355 @@
+/**********************************************************************
+**	SOURCE FILE:	connection_table.cpp - Slab backed connection table
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      ConnectionTable();
+**      Connection * acquire(int);
+**      void release(Connection *);
+**      void recycle();
+**      Connection * lookup(int);
+**      int getActiveCount();
+**      int getCapacity();
+**      size_t getMemoryUsage();
+**      bool addSlab();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Keeps a worker's Connection records. Records are carved out of
+** cache-line-aligned slabs of CONNECTION_SLAB_SIZE and never freed;
+** a closed record goes back on a free list, so accepting and closing
+** clients does not touch malloc once the worker has warmed up. The
+** table is indexed by socket descriptor and grows with the highest
+** descriptor seen, so it is not limited to FD_SETSIZE.
+**
+** Records closed while a batch of events is being handled are
+** held back until recycle() is called after the batch, so an event
+** later in the same batch can never land on a record that has
+** already been handed to a new client.
+*************************************************************************/
+#include <iostream>
+#include <new>
+#include <stdlib.h>
+#include "connection_table.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: ConnectionTable
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			ConnectionTable()
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Base constructor for an empty table.
+*********************************************************************/
+ConnectionTable::ConnectionTable()
+{
+    activeCount = 0;
+    slabCount = 0;
+}
+
+
+/*****************************************************************
+** Function: acquire
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			Connection * acquire(int sockVal)
+**          int sockVal -- newly accepted client socket
+**
+** Returns:
+**			Connection * -- record opened for the client
+**                       -- NULL if no memory is left
+**
+** Notes:
+** Takes a free record, opens it for the client and files it under
+** its socket descriptor.
+*********************************************************************/
+Connection * ConnectionTable::acquire(int sockVal)
+{
+    if (freeRecords.empty() && !addSlab())
+    {
+        return NULL;
+    }
+
+    //grow the table to cover the new descriptor
+    if (sockVal >= (int) table.size())
+    {
+        size_t newSize = table.empty() ? CONNECTION_SLAB_SIZE : table.size();
+        while ((int) newSize <= sockVal)
+        {
+            newSize *= 2;
+        }
+        table.resize(newSize, NULL);
+    }
+
+    Connection *record = freeRecords.back();
+    freeRecords.pop_back();
+
+    record->open(sockVal);
+    table[sockVal] = record;
+    activeCount++;
+
+    return record;
+}
+
+
+/*****************************************************************
+** Function: release
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void release(Connection *record)
+**          Connection *record -- record of a client being closed
+**
+** Returns:
+**			void
+**
+** Notes:
+** Removes a record from the table. It is reused after the next
+** call to recycle.
+*********************************************************************/
+void ConnectionTable::release(Connection *record)
+{
+    int sockVal = record->getSocketValue();
+
+    if (sockVal >= 0 && sockVal < (int) table.size() && table[sockVal] == record)
+    {
+        table[sockVal] = NULL;
+    }
+
+    retiredRecords.push_back(record);
+    activeCount--;
+}
+
+
+/*****************************************************************
+** Function: recycle
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void recycle()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Puts records released during the last batch back on the free list.
+*********************************************************************/
+void ConnectionTable::recycle()
+{
+    freeRecords.insert(freeRecords.end(), retiredRecords.begin(), retiredRecords.end());
+    retiredRecords.clear();
+}
+
+
+/*****************************************************************
+** Function: lookup
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			Connection * lookup(int sockVal)
+**          int sockVal -- client socket
+**
+** Returns:
+**			Connection * -- the client's record
+**                       -- NULL if the socket is not open
+**
+** Notes:
+** Finds the record for a socket descriptor.
+*********************************************************************/
+Connection * ConnectionTable::lookup(int sockVal)
+{
+    if (sockVal < 0 || sockVal >= (int) table.size())
+    {
+        return NULL;
+    }
+
+    return table[sockVal];
+}
+
+
+/*****************************************************************
+** Function: getActiveCount
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int getActiveCount()
+**
+** Returns:
+**			int -- number of open client records
+**
+** Notes:
+** Getter for the number of records in use.
+*********************************************************************/
+int ConnectionTable::getActiveCount()
+{
+    return activeCount;
+}
+
+
+/*****************************************************************
+** Function: getCapacity
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int getCapacity()
+**
+** Returns:
+**			int -- one past the highest socket the table can hold
+**
+** Notes:
+** Bound for walking every record with lookup.
+*********************************************************************/
+int ConnectionTable::getCapacity()
+{
+    return table.size();
+}
+
+
+/*****************************************************************
+** Function: getMemoryUsage
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			size_t getMemoryUsage()
+**
+** Returns:
+**			size_t -- bytes of user memory spent on clients
+**
+** Notes:
+** Adds up the record slabs, the descriptor index, the free lists and
+** the output storage the worker's connections hold. Handler state and
+** the worker's shared read buffer are not included.
+*********************************************************************/
+size_t ConnectionTable::getMemoryUsage()
+{
+    return slabCount * CONNECTION_SLAB_SIZE * sizeof(Connection)
+           + (table.capacity() + freeRecords.capacity() + retiredRecords.capacity()) * sizeof(Connection *)
+           + Connection::getBufferMemory();
+}
+
+
+/*****************************************************************
+** Function: addSlab
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			bool addSlab()
+**
+** Returns:
+**			bool -- true if a new slab was added
+**               -- false if the allocation failed
+**
+** Notes:
+** Allocates one cache-line-aligned block of CONNECTION_SLAB_SIZE
+** records and puts all of them on the free list.
+*********************************************************************/
+bool ConnectionTable::addSlab()
+{
+    void *slab;
+
+    if (posix_memalign(&slab, CACHE_LINE_SIZE, CONNECTION_SLAB_SIZE * sizeof(Connection)) != 0)
+    {
+        cerr << "Unable to allocate connection records" << endl;
+        return false;
+    }
+
+    Connection *records = (Connection *) slab;
+    slabCount++;
+    freeRecords.reserve(freeRecords.size() + CONNECTION_SLAB_SIZE);
+
+    //hand them out lowest address first
+    for (int i = CONNECTION_SLAB_SIZE - 1; i >= 0; i--)
+    {
+        freeRecords.push_back(new (&records[i]) Connection());
+    }
+
+    return true;
+}
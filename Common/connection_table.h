@@ -0,0 +1,43 @@
+#ifndef CONNECTION_TABLE_H
+#define CONNECTION_TABLE_H
+
+#include <vector>
+#include "connection.h"
+
+//records carved out of each slab allocation
+#define CONNECTION_SLAB_SIZE 256
+
+class ConnectionTable
+{
+    public:
+        /** Initializers **/
+        ConnectionTable();
+
+        /** Record management **/
+        Connection * acquire(int);
+        void release(Connection *);
+        void recycle();
+
+        /** Lookups **/
+        Connection * lookup(int);
+        int getActiveCount();
+        int getCapacity();
+        size_t getMemoryUsage();
+
+    private:
+        bool addSlab();
+
+        //records indexed by socket descriptor
+        std::vector<Connection *> table;
+
+        //records ready for reuse
+        std::vector<Connection *> freeRecords;
+
+        //records closed during the current batch of events
+        std::vector<Connection *> retiredRecords;
+
+        int activeCount;
+        size_t slabCount;
+};
+
+#endif //CONNECTION_TABLE_H
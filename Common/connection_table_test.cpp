@@ -0,0 +1,246 @@
+/**********************************************************************
+**	SOURCE FILE:	connection_table_test.cpp - Tests for ConnectionTable
+**
+**	PROGRAM:	Scalable Server -- unit tests
+**
+**	FUNCTIONS:
+**      int main();
+**      static void testLookup();
+**      static void testGrowth();
+**      static void testRecycle();
+**      static void testSlabs();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Drives a ConnectionTable with made-up descriptor numbers; no
+** sockets are opened. Run with make test.
+*************************************************************************/
+#include "check.h"
+#include "connection_table.h"
+
+using namespace std;
+
+static void testLookup();
+static void testGrowth();
+static void testRecycle();
+static void testSlabs();
+
+
+/*****************************************************************
+** Function: main
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		     int main()
+**
+** Returns:
+**			int -- 0 if every check passed
+**              -- 1 otherwise
+**
+** Notes:
+** Runs every test.
+**********************************************************************/
+int main()
+{
+    testLookup();
+    testGrowth();
+    testRecycle();
+    testSlabs();
+
+    return CHECK_RESULT("connection_table");
+}
+
+
+/*****************************************************************
+** Function: testLookup
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testLookup()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A record is found by its descriptor until it is released.
+**********************************************************************/
+static void testLookup()
+{
+    ConnectionTable connections;
+
+    CHECK(connections.lookup(5) == NULL);
+    CHECK(connections.lookup(-1) == NULL);
+
+    Connection *record = connections.acquire(5);
+    CHECK(record != NULL);
+    CHECK(record->getSocketValue() == 5);
+    CHECK(connections.lookup(5) == record);
+    CHECK(connections.lookup(6) == NULL);
+    CHECK(connections.getActiveCount() == 1);
+
+    connections.release(record);
+    CHECK(connections.lookup(5) == NULL);
+    CHECK(connections.getActiveCount() == 0);
+}
+
+
+/*****************************************************************
+** Function: testGrowth
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testGrowth()
+**
+** Returns:
+**			void
+**
+** Notes:
+** The index doubles to cover a descriptor past its end, well beyond
+** FD_SETSIZE if need be.
+**********************************************************************/
+static void testGrowth()
+{
+    ConnectionTable connections;
+
+    connections.acquire(3);
+    CHECK(connections.getCapacity() == CONNECTION_SLAB_SIZE);
+
+    Connection *far = connections.acquire(5000);
+    CHECK(far != NULL);
+    CHECK(connections.getCapacity() == 8192);
+    CHECK(connections.lookup(5000) == far);
+    CHECK(connections.lookup(3) != NULL);
+    CHECK(connections.lookup(8192) == NULL);
+}
+
+
+/*****************************************************************
+** Function: testRecycle
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testRecycle()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A released record is not handed out again until recycle() runs,
+** and then it is the next one handed out.
+**********************************************************************/
+static void testRecycle()
+{
+    ConnectionTable connections;
+
+    Connection *first = connections.acquire(10);
+    connections.release(first);
+
+    //same batch: the closed record must not come back yet
+    Connection *second = connections.acquire(10);
+    CHECK(second != first);
+    CHECK(connections.lookup(10) == second);
+
+    connections.release(second);
+    connections.recycle();
+
+    Connection *third = connections.acquire(11);
+    CHECK(third == second || third == first);
+    CHECK(third->getSocketValue() == 11);
+    CHECK(third->getEvents() == 0);
+    CHECK(third->pendingOutput() == 0);
+    CHECK(!third->hasPipe());
+}
+
+
+/*****************************************************************
+** Function: testSlabs
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testSlabs()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Records come CONNECTION_SLAB_SIZE to an allocation, cache-line
+** aligned, and a warmed-up table reuses them instead of allocating
+** another slab.
+**********************************************************************/
+static void testSlabs()
+{
+    ConnectionTable connections;
+    Connection *records[CONNECTION_SLAB_SIZE + 1];
+
+    for (int i = 0; i < CONNECTION_SLAB_SIZE; i++)
+    {
+        records[i] = connections.acquire(i);
+        CHECK(((size_t) records[i]) % CACHE_LINE_SIZE == 0);
+    }
+    size_t oneSlab = connections.getMemoryUsage();
+
+    //one past the slab takes a second one
+    records[CONNECTION_SLAB_SIZE] = connections.acquire(CONNECTION_SLAB_SIZE);
+    size_t twoSlabs = connections.getMemoryUsage();
+    CHECK(twoSlabs >= oneSlab + CONNECTION_SLAB_SIZE * sizeof(Connection));
+
+    //closing and reopening every client takes no new slab
+    for (int i = 0; i <= CONNECTION_SLAB_SIZE; i++)
+    {
+        connections.release(records[i]);
+    }
+    connections.recycle();
+    for (int i = 0; i <= CONNECTION_SLAB_SIZE; i++)
+    {
+        CHECK(connections.acquire(i) != NULL);
+    }
+    CHECK(connections.getMemoryUsage() < twoSlabs + CONNECTION_SLAB_SIZE * sizeof(Connection));
+    CHECK(connections.getActiveCount() == CONNECTION_SLAB_SIZE + 1);
+}
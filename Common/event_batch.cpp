@@ -0,0 +1,202 @@
+/**********************************************************************
+**	SOURCE FILE:	event_batch.cpp - Self-sizing epoll event array
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      EventBatch(int);
+**      struct epoll_event * getEvents();
+**      int getCapacity();
+**      void record(int);
+**      void resize(int);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** The array a worker hands to epoll_wait. It starts at
+** EVENT_BATCH_MIN entries and doubles whenever a wakeup fills it, up
+** to the configured batch size. When the average wakeup over the last
+** EVENT_BATCH_WINDOW has used less than a quarter of it, it halves and
+** gives the memory back, so a quiet worker does not keep a batch sized
+** for its busiest moment.
+*************************************************************************/
+#include "event_batch.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: EventBatch
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			EventBatch(int maxEvents)
+**          int maxEvents -- largest batch to grow to
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Starts with the smallest batch.
+*********************************************************************/
+EventBatch::EventBatch(int maxEvents)
+{
+    maxCapacity = maxEvents;
+    resize(maxEvents < EVENT_BATCH_MIN ? maxEvents : EVENT_BATCH_MIN);
+}
+
+
+/*****************************************************************
+** Function: getEvents
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			struct epoll_event * getEvents()
+**
+** Returns:
+**			struct epoll_event * -- array to pass to epoll_wait
+**
+** Notes:
+** Only valid until the next call to record.
+*********************************************************************/
+struct epoll_event * EventBatch::getEvents()
+{
+    return &events[0];
+}
+
+
+/*****************************************************************
+** Function: getCapacity
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int getCapacity()
+**
+** Returns:
+**			int -- number of events the array holds
+**
+** Notes:
+** Pass as maxevents to epoll_wait.
+*********************************************************************/
+int EventBatch::getCapacity()
+{
+    return events.size();
+}
+
+
+/*****************************************************************
+** Function: record
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void record(int numReady)
+**          int numReady -- events returned by the last epoll_wait
+**
+** Returns:
+**			void
+**
+** Notes:
+** Resizes the batch from how full recent wakeups were. Call once the
+** events of the last wakeup have been handled.
+*********************************************************************/
+void EventBatch::record(int numReady)
+{
+    int capacity = getCapacity();
+
+    if (numReady < 0)
+    {
+        return;
+    }
+
+    //ran out of room; more events were probably waiting
+    if (numReady == capacity && capacity < maxCapacity)
+    {
+        resize(capacity * 2 < maxCapacity ? capacity * 2 : maxCapacity);
+        return;
+    }
+
+    readyTotal += numReady;
+    if (++wakeups < EVENT_BATCH_WINDOW)
+    {
+        return;
+    }
+
+    //mostly empty over the window
+    if (readyTotal < (long long) capacity * EVENT_BATCH_WINDOW / 4 && capacity > EVENT_BATCH_MIN)
+    {
+        resize(capacity / 2 > EVENT_BATCH_MIN ? capacity / 2 : EVENT_BATCH_MIN);
+        return;
+    }
+
+    readyTotal = 0;
+    wakeups = 0;
+}
+
+
+/*****************************************************************
+** Function: resize
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void resize(int capacity)
+**          int capacity -- new number of events
+**
+** Returns:
+**			void
+**
+** Notes:
+** Reallocates to exactly the new size so shrinking frees memory, and
+** starts a new averaging window.
+*********************************************************************/
+void EventBatch::resize(int capacity)
+{
+    vector<struct epoll_event>(capacity).swap(events);
+    readyTotal = 0;
+    wakeups = 0;
+}
@@ -0,0 +1,39 @@
+#ifndef EVENT_BATCH_H
+#define EVENT_BATCH_H
+
+#include <vector>
+#include <sys/epoll.h>
+
+//smallest batch a worker shrinks back to
+#define EVENT_BATCH_MIN 64
+
+//wakeups averaged before the batch is shrunk
+#define EVENT_BATCH_WINDOW 64
+
+class EventBatch
+{
+    public:
+        /** Initializers **/
+        EventBatch(int);
+
+        /** Getters **/
+        struct epoll_event * getEvents();
+        int getCapacity();
+
+        /** Sizing **/
+        void record(int);
+
+    private:
+        void resize(int);
+
+        std::vector<struct epoll_event> events;
+
+        //largest batch allowed
+        int maxCapacity;
+
+        //ready counts seen since the batch last changed size
+        long long readyTotal;
+        int wakeups;
+};
+
+#endif //EVENT_BATCH_H
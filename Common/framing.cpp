@@ -0,0 +1,523 @@
+/**********************************************************************
+**	SOURCE FILE:	framing.cpp - Length-prefixed message framing
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      FrameParser();
+**      void reset();
+**      void feed(const char *, size_t);
+**      int next(const char **, size_t *);
+**      void keepInput(size_t);
+**      void encodeFrameHeader(char *, size_t);
+**      int sendFrame(ClientChannel &, const char *, size_t);
+**      static size_t decodeFrameHeader(const char *);
+**      const char *getName();
+**      int onAccept(ClientChannel &);
+**      int onData(ClientChannel &, const char *, size_t);
+**      void onClose(ClientChannel &);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** TCP delivers a stream, so one recv can hold several messages or
+** only part of one. Here every message is led by its length as a
+** FRAME_HEADER_SIZE byte big-endian integer.
+**
+** A FrameParser is fed each read as it arrives and hands back the
+** messages in it one by one. A message that lies wholly inside the
+** read is returned as a view of the read buffer, without a copy. Only
+** a message cut off by the end of a read is copied, into the parser's
+** own buffer, and handed out from there once the rest has arrived.
+** Either way a message is valid until the next call to next or feed.
+**
+** The framed handler (-x framed) echoes every message back as a
+** message of its own, with one parser per client.
+*************************************************************************/
+#include <cstring>
+#include "framing.h"
+
+using namespace std;
+
+static size_t decodeFrameHeader(const char *);
+
+
+/*****************************************************************
+** Function: FrameParser
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    FrameParser()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Creates a parser waiting for the start of a message.
+**********************************************************************/
+FrameParser::FrameParser()
+{
+    reset();
+}
+
+
+/*****************************************************************
+** Function: reset
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void reset()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Drops any input and partial message, as for a new stream.
+**********************************************************************/
+void FrameParser::reset()
+{
+    input = NULL;
+    inputLeft = 0;
+    partial.clear();
+    partialWanted = 0;
+    partialDone = false;
+}
+
+
+/*****************************************************************
+** Function: feed
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void feed(const char *data, size_t length)
+**              const char *data -- bytes just read
+**              size_t length -- number of bytes
+**
+** Returns:
+**			void
+**
+** Notes:
+** Gives the parser the next part of the stream. The bytes are not
+** copied, so they must stay put until next has returned 0.
+**********************************************************************/
+void FrameParser::feed(const char *data, size_t length)
+{
+    input = data;
+    inputLeft = length;
+}
+
+
+/*****************************************************************
+** Function: next
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int next(const char **message, size_t *length)
+**              const char **message -- set to the message body
+**              size_t *length -- set to its length
+**
+** Returns:
+**			int -- 1 if a message was returned
+**              -- 0 if the input is used up
+**              -- -1 if a header gives a length over FRAME_MAX_LENGTH
+**
+** Notes:
+** Returns the next whole message. When the input ends part way into
+** a message that part is kept and 0 returned; the rest is picked up
+** from the following feed.
+**********************************************************************/
+int FrameParser::next(const char **message, size_t *length)
+{
+    size_t bodyLength;
+
+    //the last message came out of the partial buffer; start afresh
+    if (partialDone)
+    {
+        partial.clear();
+        if (partial.capacity() > FRAME_KEEP_CAPACITY)
+        {
+            vector<char>().swap(partial);
+        }
+        partialWanted = 0;
+        partialDone = false;
+    }
+
+    //finish a message begun in an earlier read
+    if (!partial.empty())
+    {
+        //its header may have been split too
+        if (partial.size() < FRAME_HEADER_SIZE)
+        {
+            keepInput(FRAME_HEADER_SIZE - partial.size());
+            if (partial.size() < FRAME_HEADER_SIZE)
+            {
+                return 0;
+            }
+
+            bodyLength = decodeFrameHeader(&partial[0]);
+            if (bodyLength > FRAME_MAX_LENGTH)
+            {
+                return -1;
+            }
+            partialWanted = FRAME_HEADER_SIZE + bodyLength;
+            partial.reserve(partialWanted < FRAME_RESERVE_LENGTH ? partialWanted : FRAME_RESERVE_LENGTH);
+        }
+
+        keepInput(partialWanted - partial.size());
+        if (partial.size() < partialWanted)
+        {
+            return 0;
+        }
+
+        *message = partial.data() + FRAME_HEADER_SIZE;
+        *length = partialWanted - FRAME_HEADER_SIZE;
+        partialDone = true;
+        return 1;
+    }
+
+    if (inputLeft == 0)
+    {
+        return 0;
+    }
+
+    if (inputLeft >= FRAME_HEADER_SIZE)
+    {
+        bodyLength = decodeFrameHeader(input);
+        if (bodyLength > FRAME_MAX_LENGTH)
+        {
+            return -1;
+        }
+
+        //whole message is in the read; hand it out where it lies
+        if (inputLeft - FRAME_HEADER_SIZE >= bodyLength)
+        {
+            *message = input + FRAME_HEADER_SIZE;
+            *length = bodyLength;
+            input += FRAME_HEADER_SIZE + bodyLength;
+            inputLeft -= FRAME_HEADER_SIZE + bodyLength;
+            return 1;
+        }
+
+        partialWanted = FRAME_HEADER_SIZE + bodyLength;
+        partial.reserve(partialWanted < FRAME_RESERVE_LENGTH ? partialWanted : FRAME_RESERVE_LENGTH);
+    }
+
+    //the message runs on into the next read
+    keepInput(inputLeft);
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: keepInput
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void keepInput(size_t wanted)
+**              size_t wanted -- most bytes to take
+**
+** Returns:
+**			void
+**
+** Notes:
+** Moves up to wanted bytes of input onto the partial message.
+**********************************************************************/
+void FrameParser::keepInput(size_t wanted)
+{
+    if (wanted > inputLeft)
+    {
+        wanted = inputLeft;
+    }
+
+    partial.insert(partial.end(), input, input + wanted);
+    input += wanted;
+    inputLeft -= wanted;
+}
+
+
+/*****************************************************************
+** Function: encodeFrameHeader
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void encodeFrameHeader(char *header, size_t length)
+**              char *header -- FRAME_HEADER_SIZE bytes to fill in
+**              size_t length -- length of the message it leads
+**
+** Returns:
+**			void
+**
+** Notes:
+** Writes a message length in the order decodeFrameHeader reads it.
+**********************************************************************/
+void encodeFrameHeader(char *header, size_t length)
+{
+    header[0] = (char) (length >> 24);
+    header[1] = (char) (length >> 16);
+    header[2] = (char) (length >> 8);
+    header[3] = (char) length;
+}
+
+
+/*****************************************************************
+** Function: sendFrame
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int sendFrame(ClientChannel &client, const char *message, size_t length)
+**              ClientChannel &client -- client to send to
+**              const char *message -- message body
+**              size_t length -- its length
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if the client failed
+**
+** Notes:
+** Sends one message with its header. A small message is copied behind
+** the header so both go out in one write; a large one is sent in place
+** after its header rather than copied.
+**********************************************************************/
+int sendFrame(ClientChannel &client, const char *message, size_t length)
+{
+    if (length <= FRAME_COALESCE_LENGTH)
+    {
+        char frame[FRAME_HEADER_SIZE + FRAME_COALESCE_LENGTH];
+
+        encodeFrameHeader(frame, length);
+        memcpy(frame + FRAME_HEADER_SIZE, message, length);
+        return client.sendData(frame, FRAME_HEADER_SIZE + length);
+    }
+
+    char header[FRAME_HEADER_SIZE];
+
+    encodeFrameHeader(header, length);
+    if (client.sendData(header, FRAME_HEADER_SIZE) == -1)
+    {
+        return -1;
+    }
+    return client.sendData(message, length);
+}
+
+
+/*****************************************************************
+** Function: decodeFrameHeader
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static size_t decodeFrameHeader(const char *header)
+**              const char *header -- FRAME_HEADER_SIZE bytes
+**
+** Returns:
+**			size_t -- length of the message the header leads
+**
+** Notes:
+** Reads a big-endian message length.
+**********************************************************************/
+static size_t decodeFrameHeader(const char *header)
+{
+    const unsigned char *bytes = (const unsigned char *) header;
+
+    return ((size_t) bytes[0] << 24) | ((size_t) bytes[1] << 16) | ((size_t) bytes[2] << 8) | bytes[3];
+}
+
+
+/*****************************************************************
+** Function: getName
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    const char *getName()
+**
+** Returns:
+**			const char * -- name -x selects the handler by
+**
+** Notes:
+** Names the framed echo handler.
+**********************************************************************/
+const char *FramedHandler::getName()
+{
+    return "framed";
+}
+
+
+/*****************************************************************
+** Function: onAccept
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int onAccept(ClientChannel &client)
+**              ClientChannel &client -- newly accepted client
+**
+** Returns:
+**			int -- 0 to keep the client
+**
+** Notes:
+** Gives the client a parser of its own.
+**********************************************************************/
+int FramedHandler::onAccept(ClientChannel &client)
+{
+    client.handlerState = new FrameParser();
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: onData
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int onData(ClientChannel &client, const char *data, size_t length)
+**              ClientChannel &client -- client the bytes came from
+**              const char *data -- bytes received
+**              size_t length -- number of bytes
+**
+** Returns:
+**			int -- 0 to keep the client
+**              -- -1 to close it on a bad header or failed send
+**
+** Notes:
+** Echoes every message the read completes.
+**********************************************************************/
+int FramedHandler::onData(ClientChannel &client, const char *data, size_t length)
+{
+    FrameParser *parser = (FrameParser *) client.handlerState;
+    const char *message;
+    size_t messageLength;
+    int result;
+
+    parser->feed(data, length);
+
+    while ((result = parser->next(&message, &messageLength)) == 1)
+    {
+        if (sendFrame(client, message, messageLength) == -1)
+        {
+            return -1;
+        }
+    }
+
+    return result;
+}
+
+
+/*****************************************************************
+** Function: onClose
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void onClose(ClientChannel &client)
+**              ClientChannel &client -- client being closed
+**
+** Returns:
+**			void
+**
+** Notes:
+** Frees the client's parser and any partial message in it.
+**********************************************************************/
+void FramedHandler::onClose(ClientChannel &client)
+{
+    delete (FrameParser *) client.handlerState;
+    client.handlerState = NULL;
+}
@@ -0,0 +1,64 @@
+#ifndef FRAMING_H
+#define FRAMING_H
+
+#include <vector>
+#include <cstddef>
+#include "handler.h"
+
+//every message is led by its length as a 4-byte big-endian integer
+#define FRAME_HEADER_SIZE 4
+
+//longest message accepted; anything longer is treated as garbage
+#define FRAME_MAX_LENGTH (16 * 1024 * 1024)
+
+//messages up to this size are sent with their header in one write
+#define FRAME_COALESCE_LENGTH 4096
+
+//a split message buffer bigger than this is freed once it is used
+#define FRAME_KEEP_CAPACITY 65536
+
+//most set aside for a split message before its bytes arrive; past
+//this the buffer grows as they do, so a bare header cannot claim
+//FRAME_MAX_LENGTH bytes
+#define FRAME_RESERVE_LENGTH 65536
+
+/** Splits a byte stream into length-prefixed messages **/
+class FrameParser
+{
+    public:
+        FrameParser();
+        void reset();
+
+        /** Parsing **/
+        void feed(const char *, size_t);
+        int next(const char **, size_t *);
+
+    private:
+        void keepInput(size_t);
+
+        //input passed to feed that has not been parsed yet
+        const char *input;
+        size_t inputLeft;
+
+        //a message split across reads, header included, as it builds up
+        std::vector<char> partial;
+        size_t partialWanted;
+
+        //partial held a finished message, handed out by the last next
+        bool partialDone;
+};
+
+void encodeFrameHeader(char *, size_t);
+int sendFrame(ClientChannel &, const char *, size_t);
+
+/** Echoes every message back as a message of its own **/
+class FramedHandler : public Handler
+{
+    public:
+        const char *getName();
+        int onAccept(ClientChannel &);
+        int onData(ClientChannel &, const char *, size_t);
+        void onClose(ClientChannel &);
+};
+
+#endif //FRAMING_H
@@ -0,0 +1,325 @@
+/**********************************************************************
+**	SOURCE FILE:	framing_test.cpp - Tests for FrameParser
+**
+**	PROGRAM:	Scalable Server -- unit tests
+**
+**	FUNCTIONS:
+**      int main();
+**      static std::string frame(const std::string &);
+**      static int drain(FrameParser &, std::vector<std::string> &);
+**      static void testWholeMessages();
+**      static void testSplitHeader();
+**      static void testByteAtATime();
+**      static void testOversize();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Feeds a FrameParser streams cut at awkward places, as reads from a
+** socket would be. Run with make test.
+*************************************************************************/
+#include <string>
+#include <vector>
+#include "check.h"
+#include "framing.h"
+
+using namespace std;
+
+static string frame(const string &);
+static int drain(FrameParser &, vector<string> &);
+static void testWholeMessages();
+static void testSplitHeader();
+static void testByteAtATime();
+static void testOversize();
+
+
+/*****************************************************************
+** Function: main
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		     int main()
+**
+** Returns:
+**			int -- 0 if every check passed
+**              -- 1 otherwise
+**
+** Notes:
+** Runs every test.
+**********************************************************************/
+int main()
+{
+    testWholeMessages();
+    testSplitHeader();
+    testByteAtATime();
+    testOversize();
+
+    return CHECK_RESULT("framing");
+}
+
+
+/*****************************************************************
+** Function: frame
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static string frame(const string &body)
+**              const string &body -- message to wrap
+**
+** Returns:
+**			string -- the message led by its header
+**
+** Notes:
+** Builds a message as a client would send it.
+**********************************************************************/
+static string frame(const string &body)
+{
+    char header[FRAME_HEADER_SIZE];
+
+    encodeFrameHeader(header, body.size());
+    return string(header, FRAME_HEADER_SIZE) + body;
+}
+
+
+/*****************************************************************
+** Function: drain
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static int drain(FrameParser &parser, vector<string> &messages)
+**              FrameParser &parser -- parser that was just fed
+**              vector<string> &messages -- gets every message returned
+**
+** Returns:
+**			int -- what the last call to next returned
+**
+** Notes:
+** Takes every whole message out of the parser.
+**********************************************************************/
+static int drain(FrameParser &parser, vector<string> &messages)
+{
+    const char *message;
+    size_t length;
+    int result;
+
+    while ((result = parser.next(&message, &length)) == 1)
+    {
+        messages.push_back(string(message, length));
+    }
+
+    return result;
+}
+
+
+/*****************************************************************
+** Function: testWholeMessages
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testWholeMessages()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Messages that arrive whole, empty ones included, are handed out
+** where they lie in the read rather than copied.
+**********************************************************************/
+static void testWholeMessages()
+{
+    FrameParser parser;
+    string stream = frame("hello") + frame("") + frame("world");
+    const char *message;
+    size_t length;
+
+    parser.feed(stream.data(), stream.size());
+
+    CHECK(parser.next(&message, &length) == 1);
+    CHECK(length == 5);
+    CHECK(message == stream.data() + FRAME_HEADER_SIZE);
+
+    vector<string> rest;
+    CHECK(drain(parser, rest) == 0);
+    CHECK(rest.size() == 2);
+    CHECK(rest.size() == 2 && rest[0] == "" && rest[1] == "world");
+}
+
+
+/*****************************************************************
+** Function: testSplitHeader
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testSplitHeader()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A header cut after every possible byte, and a body cut across
+** several reads, still come out as one message, followed by the
+** message behind it in the last read.
+**********************************************************************/
+static void testSplitHeader()
+{
+    string body(10000, 'x');
+    string stream = frame(body) + frame("next");
+
+    for (size_t cut = 1; cut < FRAME_HEADER_SIZE; cut++)
+    {
+        FrameParser parser;
+        vector<string> messages;
+
+        parser.feed(stream.data(), cut);
+        CHECK(drain(parser, messages) == 0);
+
+        //the body in three pieces
+        size_t second = cut + 3000;
+        size_t third = second + 4000;
+        parser.feed(stream.data() + cut, second - cut);
+        CHECK(drain(parser, messages) == 0);
+        parser.feed(stream.data() + second, third - second);
+        CHECK(drain(parser, messages) == 0);
+        CHECK(messages.empty());
+
+        parser.feed(stream.data() + third, stream.size() - third);
+        CHECK(drain(parser, messages) == 0);
+        CHECK(messages.size() == 2);
+        CHECK(messages.size() == 2 && messages[0] == body && messages[1] == "next");
+    }
+}
+
+
+/*****************************************************************
+** Function: testByteAtATime
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testByteAtATime()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A stream fed one byte per read comes out the same as fed whole.
+**********************************************************************/
+static void testByteAtATime()
+{
+    FrameParser parser;
+    vector<string> messages;
+    string stream = frame("a") + frame("") + frame(string(300, 'b')) + frame("cd");
+
+    for (size_t i = 0; i < stream.size(); i++)
+    {
+        parser.feed(stream.data() + i, 1);
+        CHECK(drain(parser, messages) == 0);
+    }
+
+    CHECK(messages.size() == 4);
+    CHECK(messages.size() == 4 && messages[0] == "a" && messages[1] == ""
+          && messages[2] == string(300, 'b') && messages[3] == "cd");
+}
+
+
+/*****************************************************************
+** Function: testOversize
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testOversize()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A length over FRAME_MAX_LENGTH is refused whether its header
+** arrives whole or split; FRAME_MAX_LENGTH itself is waited for.
+**********************************************************************/
+static void testOversize()
+{
+    char header[FRAME_HEADER_SIZE];
+    vector<string> messages;
+
+    encodeFrameHeader(header, FRAME_MAX_LENGTH + 1);
+
+    FrameParser whole;
+    whole.feed(header, FRAME_HEADER_SIZE);
+    CHECK(drain(whole, messages) == -1);
+
+    FrameParser split;
+    split.feed(header, 2);
+    CHECK(drain(split, messages) == 0);
+    split.feed(header + 2, FRAME_HEADER_SIZE - 2);
+    CHECK(drain(split, messages) == -1);
+
+    encodeFrameHeader(header, FRAME_MAX_LENGTH);
+
+    FrameParser largest;
+    largest.feed(header, 3);
+    CHECK(drain(largest, messages) == 0);
+    largest.feed(header + 3, 1);
+    CHECK(drain(largest, messages) == 0);
+    CHECK(messages.empty());
+}
@@ -0,0 +1,264 @@
+/**********************************************************************
+**	SOURCE FILE:	handler.cpp - What the servers do with their clients
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      ClientChannel();
+**      int onAccept(ClientChannel &);
+**      int onData(ClientChannel &, const char *, size_t);
+**      int onWritable(ClientChannel &);
+**      void onClose(ClientChannel &);
+**      Handler *findHandler(const char *);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Separates the protocol from the event engines. The engines own the
+** sockets and call the selected Handler when a client connects, when
+** bytes arrive, when queued output has all been written and when the
+** client is closed. Received bytes are passed as a view of the
+** engine's read buffer, valid only for the duration of the call.
+**
+** A handler talks back through the client's ClientChannel, which also
+** carries one pointer of per-client state for it. Handlers themselves
+** are shared by every client and, in the thread model, every worker,
+** so they must keep nothing else between calls.
+*************************************************************************/
+#include <cstring>
+#include "handler.h"
+#include "framing.h"
+#include "http.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: ClientChannel
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    ClientChannel()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Starts the channel with no handler state.
+**********************************************************************/
+ClientChannel::ClientChannel()
+{
+    handlerState = NULL;
+}
+
+ClientChannel::~ClientChannel()
+{
+}
+
+
+Handler::~Handler()
+{
+}
+
+
+/*****************************************************************
+** Function: onAccept
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int onAccept(ClientChannel &client)
+**              ClientChannel &client -- newly accepted client
+**
+** Returns:
+**			int -- 0 to keep the client
+**              -- -1 to close it
+**
+** Notes:
+** Called once the engine is watching the client. Handlers that keep
+** per-client state set it up here; the default keeps none.
+**********************************************************************/
+int Handler::onAccept(ClientChannel &)
+{
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: onWritable
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int onWritable(ClientChannel &client)
+**              ClientChannel &client -- client whose queue emptied
+**
+** Returns:
+**			int -- 0 to keep the client
+**              -- -1 to close it
+**
+** Notes:
+** Called when output the socket could not take at once has all been
+** written, so a handler streaming a large reply can send the next
+** part. The default has nothing more to send.
+**********************************************************************/
+int Handler::onWritable(ClientChannel &)
+{
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: onClose
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void onClose(ClientChannel &client)
+**              ClientChannel &client -- client being closed
+**
+** Returns:
+**			void
+**
+** Notes:
+** Called once for every accepted client, however it is closed, while
+** its socket is still open. Handlers free their per-client state here.
+**********************************************************************/
+void Handler::onClose(ClientChannel &)
+{
+}
+
+
+/*****************************************************************
+** Function: getName
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    const char *getName()
+**
+** Returns:
+**			const char * -- name -x selects the handler by
+**
+** Notes:
+** Names the echo handler.
+**********************************************************************/
+const char *EchoHandler::getName()
+{
+    return "echo";
+}
+
+
+/*****************************************************************
+** Function: onData
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int onData(ClientChannel &client, const char *data, size_t length)
+**              ClientChannel &client -- client the bytes came from
+**              const char *data -- bytes received
+**              size_t length -- number of bytes
+**
+** Returns:
+**			int -- 0 to keep the client
+**              -- -1 to close it
+**
+** Notes:
+** Sends the bytes straight back.
+**********************************************************************/
+int EchoHandler::onData(ClientChannel &client, const char *data, size_t length)
+{
+    return client.sendData(data, length);
+}
+
+
+/*****************************************************************
+** Function: findHandler
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    Handler *findHandler(const char *name)
+**              const char *name -- name given to -x
+**
+** Returns:
+**			Handler * -- the handler by that name
+**              -- NULL if there is none
+**
+** Notes:
+** Looks a handler up among the ones built in.
+**********************************************************************/
+Handler *findHandler(const char *name)
+{
+    static EchoHandler echo;
+    static FramedHandler framed;
+    static HttpHandler http;
+    static Handler *handlers[] = {&echo, &framed, &http};
+
+    for (size_t i = 0; i < sizeof(handlers) / sizeof(handlers[0]); i++)
+    {
+        if (strcmp(handlers[i]->getName(), name) == 0)
+        {
+            return handlers[i];
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,51 @@
+#ifndef HANDLER_H
+#define HANDLER_H
+
+#include <cstddef>
+
+/** A client as a handler sees it; each engine provides the channel **/
+class ClientChannel
+{
+    public:
+        ClientChannel();
+        virtual ~ClientChannel();
+
+        virtual int getSocketValue() = 0;
+
+        /** Output **/
+        virtual int sendData(const char *, size_t) = 0;
+        virtual size_t pendingOutput() = 0;
+
+        //whatever the handler keeps for this client between events
+        void *handlerState;
+};
+
+/** What a server does with its clients **/
+class Handler
+{
+    public:
+        virtual ~Handler();
+        virtual const char *getName() = 0;
+
+        /** Events; returning -1 closes the client **/
+        virtual int onAccept(ClientChannel &);
+        virtual int onData(ClientChannel &, const char *, size_t) = 0;
+        virtual int onWritable(ClientChannel &);
+        virtual void onClose(ClientChannel &);
+};
+
+/** Default handler: sends every byte straight back **/
+class EchoHandler : public Handler
+{
+    public:
+        const char *getName();
+        int onData(ClientChannel &, const char *, size_t);
+};
+
+//handler -x selects by name, NULL if there is none
+Handler *findHandler(const char *);
+
+//the handler used when none is selected
+#define DEFAULT_HANDLER "echo"
+
+#endif //HANDLER_H
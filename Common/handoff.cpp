@@ -0,0 +1,462 @@
+/**********************************************************************
+**	SOURCE FILE:	handoff.cpp - Listening socket handoff for restarts
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+** int openHandoff(const char *)
+** int requestListeners(const char *, std::vector<int> &)
+** int confirmHandoff(int)
+** int offerListeners(int, const std::vector<int> &)
+** void closeHandoff(int, const char *, bool)
+** static int setHandoffAddress(struct sockaddr_un &, const char *)
+** static void setReceiveTimeout(int)
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Lets a freshly started server take the listening sockets over from
+** the one it replaces, so the port never closes during a deploy and
+** nothing queued in the accept backlog is lost.
+**
+** A running server listens on a Unix seqpacket socket at the handoff
+** path. A new server started with the same path connects to it and is
+** sent every listener as SCM_RIGHTS, HANDOFF_CHUNK at a time, each
+** message led by a HandoffHeader. Once its own workers are up it
+** answers with one byte; only then does the old server stop accepting
+** and drain, while the new one binds the handoff path for next time.
+** If the new server never answers, the old one keeps serving.
+*************************************************************************/
+#include <iostream>
+#include <cstring>
+#include <stdio.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include "handoff.h"
+
+using namespace std;
+
+static int setHandoffAddress(struct sockaddr_un &, const char *);
+static void setReceiveTimeout(int);
+
+/*****************************************************************
+** Function: openHandoff
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int openHandoff(const char *path)
+**              const char *path -- Unix socket path to listen on
+**
+** Returns:
+**			int -- non-blocking handoff socket
+**              -- -1 if it could not be opened
+**
+** Notes:
+** Binds the path the next server will ask for the listeners on,
+** replacing the socket file left by the server this one took over from.
+**********************************************************************/
+int openHandoff(const char *path)
+{
+    struct sockaddr_un address;
+    int handoff;
+
+    if (setHandoffAddress(address, path) == -1)
+    {
+        return -1;
+    }
+
+    handoff = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (handoff == -1)
+    {
+        perror("socket");
+        return -1;
+    }
+
+    //the previous server's socket file, if any
+    unlink(path);
+
+    if (bind(handoff, (struct sockaddr *) &address, sizeof(address)) == -1 || listen(handoff, 1) == -1)
+    {
+        perror("handoff socket");
+        close(handoff);
+        return -1;
+    }
+
+    return handoff;
+}
+
+/*****************************************************************
+** Function: requestListeners
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int requestListeners(const char *path, std::vector<int> &listeners)
+**              const char *path -- handoff path of the running server
+**              std::vector<int> &listeners -- filled with its listeners
+**
+** Returns:
+**			int -- connection to the old server, for confirmHandoff
+**              -- -1 if there is no server to take over from or the
+**                 handoff failed
+**
+** Notes:
+** Asks the server running at the path for its listening sockets. The
+** listeners arrive in the order the old server keeps them in.
+**********************************************************************/
+int requestListeners(const char *path, vector<int> &listeners)
+{
+    struct sockaddr_un address;
+    int peer;
+    int total = -1;
+
+    listeners.clear();
+
+    if (setHandoffAddress(address, path) == -1)
+    {
+        return -1;
+    }
+
+    peer = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (peer == -1)
+    {
+        perror("socket");
+        return -1;
+    }
+
+    if (connect(peer, (struct sockaddr *) &address, sizeof(address)) == -1)
+    {
+        //nobody is serving on this path; start from scratch
+        if (errno != ENOENT && errno != ECONNREFUSED)
+        {
+            perror("connect to handoff");
+        }
+        close(peer);
+        return -1;
+    }
+
+    setReceiveTimeout(peer);
+
+    while (total < 0 || (int) listeners.size() < total)
+    {
+        HandoffHeader header;
+        char control[CMSG_SPACE(sizeof(int) * HANDOFF_CHUNK)];
+        struct iovec io;
+        struct msghdr message = msghdr();
+
+        io.iov_base = &header;
+        io.iov_len = sizeof(header);
+        message.msg_iov = &io;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        ssize_t received = recvmsg(peer, &message, MSG_CMSG_CLOEXEC);
+        if (received == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        //keep whatever arrived so it can be closed
+        for (struct cmsghdr *part = CMSG_FIRSTHDR(&message); received > 0 && part != NULL; part = CMSG_NXTHDR(&message, part))
+        {
+            if (part->cmsg_level == SOL_SOCKET && part->cmsg_type == SCM_RIGHTS)
+            {
+                int count = (part->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                int *fds = (int *) CMSG_DATA(part);
+
+                listeners.insert(listeners.end(), fds, fds + count);
+            }
+        }
+
+        if (received != sizeof(header) || (message.msg_flags & MSG_CTRUNC) || header.total <= 0
+            || (total >= 0 && header.total != total) || (int) listeners.size() > header.total)
+        {
+            cerr << "Handoff from the running server failed." << endl;
+
+            for (int i = 0; i < (int) listeners.size(); i++)
+            {
+                close(listeners[i]);
+            }
+            listeners.clear();
+            close(peer);
+            return -1;
+        }
+
+        total = header.total;
+    }
+
+    return peer;
+}
+
+/*****************************************************************
+** Function: confirmHandoff
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int confirmHandoff(int peer)
+**              int peer -- connection returned by requestListeners
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the old server did not get the answer
+**
+** Notes:
+** Tells the old server this one is serving, so it can drain, and
+** closes the connection.
+**********************************************************************/
+int confirmHandoff(int peer)
+{
+    char ready = 1;
+    int result = 0;
+
+    if (send(peer, &ready, sizeof(ready), MSG_NOSIGNAL) != sizeof(ready))
+    {
+        perror("confirm handoff");
+        result = -1;
+    }
+
+    close(peer);
+    return result;
+}
+
+/*****************************************************************
+** Function: offerListeners
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int offerListeners(int handoff, const std::vector<int> &listeners)
+**              int handoff -- socket from openHandoff
+**              const std::vector<int> &listeners -- listeners to pass on
+**
+** Returns:
+**			int -- 1 if a new server took the listeners over
+**              -- 0 if no new server is asking for them
+**              -- -1 if a handoff was started but failed
+**
+** Notes:
+** Never blocks when nobody is waiting. Once a new server has asked it
+** waits up to HANDOFF_TIMEOUT_MS for it to confirm that it is serving.
+**********************************************************************/
+int offerListeners(int handoff, const vector<int> &listeners)
+{
+    int peer = accept4(handoff, NULL, NULL, SOCK_CLOEXEC);
+    char ready;
+    ssize_t received;
+
+    if (peer == -1)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR || errno == ECONNABORTED)
+        {
+            return 0;
+        }
+        perror("accept handoff");
+        return -1;
+    }
+
+    setReceiveTimeout(peer);
+
+    for (int first = 0; first < (int) listeners.size(); first += HANDOFF_CHUNK)
+    {
+        int count = (int) listeners.size() - first;
+        if (count > HANDOFF_CHUNK)
+        {
+            count = HANDOFF_CHUNK;
+        }
+
+        HandoffHeader header;
+        char control[CMSG_SPACE(sizeof(int) * HANDOFF_CHUNK)] = {};
+        struct iovec io;
+        struct msghdr message = msghdr();
+
+        header.total = listeners.size();
+        header.first = first;
+        io.iov_base = &header;
+        io.iov_len = sizeof(header);
+        message.msg_iov = &io;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = CMSG_SPACE(sizeof(int) * count);
+
+        struct cmsghdr *part = CMSG_FIRSTHDR(&message);
+        part->cmsg_level = SOL_SOCKET;
+        part->cmsg_type = SCM_RIGHTS;
+        part->cmsg_len = CMSG_LEN(sizeof(int) * count);
+        memcpy(CMSG_DATA(part), &listeners[first], sizeof(int) * count);
+
+        if (sendmsg(peer, &message, MSG_NOSIGNAL) != sizeof(header))
+        {
+            perror("send listeners");
+            close(peer);
+            return -1;
+        }
+    }
+
+    //the new server answers once its workers are up
+    do
+    {
+        received = recv(peer, &ready, sizeof(ready), 0);
+    }
+    while (received == -1 && errno == EINTR);
+
+    close(peer);
+
+    if (received != sizeof(ready))
+    {
+        cerr << "New server did not confirm the handoff; still serving." << endl;
+        return -1;
+    }
+
+    return 1;
+}
+
+/*****************************************************************
+** Function: closeHandoff
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void closeHandoff(int handoff, const char *path, bool unlinkPath)
+**              int handoff -- socket from openHandoff, or -1
+**              const char *path -- its path
+**              bool unlinkPath -- false once a new server owns the path
+**
+** Returns:
+**			void
+**
+** Notes:
+** Stops offering the listeners.
+**********************************************************************/
+void closeHandoff(int handoff, const char *path, bool unlinkPath)
+{
+    if (handoff < 0)
+    {
+        return;
+    }
+
+    close(handoff);
+
+    if (unlinkPath)
+    {
+        unlink(path);
+    }
+}
+
+/*****************************************************************
+** Function: setHandoffAddress
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static int setHandoffAddress(struct sockaddr_un &address, const char *path)
+**              struct sockaddr_un &address -- address to fill in
+**              const char *path -- Unix socket path
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the path is too long
+**
+** Notes:
+** Builds the Unix socket address for a handoff path.
+**********************************************************************/
+static int setHandoffAddress(struct sockaddr_un &address, const char *path)
+{
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (strlen(path) >= sizeof(address.sun_path))
+    {
+        cerr << "Handoff path is too long: " << path << endl;
+        return -1;
+    }
+
+    strcpy(address.sun_path, path);
+    return 0;
+}
+
+/*****************************************************************
+** Function: setReceiveTimeout
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void setReceiveTimeout(int peer)
+**              int peer -- handoff connection
+**
+** Returns:
+**			void
+**
+** Notes:
+** Bounds every wait on the other server by HANDOFF_TIMEOUT_MS so a
+** hung peer cannot stall a restart.
+**********************************************************************/
+static void setReceiveTimeout(int peer)
+{
+    struct timeval timeout;
+
+    timeout.tv_sec = HANDOFF_TIMEOUT_MS / 1000;
+    timeout.tv_usec = (HANDOFF_TIMEOUT_MS % 1000) * 1000;
+
+    setsockopt(peer, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+}
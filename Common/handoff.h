@@ -0,0 +1,26 @@
+#ifndef HANDOFF_H
+#define HANDOFF_H
+
+#include <vector>
+
+//listening sockets passed per message (the kernel allows up to 253)
+#define HANDOFF_CHUNK 64
+
+//longest the old server waits for the new one to confirm it is serving
+#define HANDOFF_TIMEOUT_MS 5000
+
+/** Leads every message of listeners **/
+struct HandoffHeader
+{
+    //listeners in the whole handoff, and index of this message's first
+    int total;
+    int first;
+};
+
+int openHandoff(const char *);
+int requestListeners(const char *, std::vector<int> &);
+int confirmHandoff(int);
+int offerListeners(int, const std::vector<int> &);
+void closeHandoff(int, const char *, bool);
+
+#endif //HANDOFF_H
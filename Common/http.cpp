@@ -0,0 +1,591 @@
+/**********************************************************************
+**	SOURCE FILE:	http.cpp - Minimal HTTP/1.1 responder
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      HttpHandler();
+**      const char *getName();
+**      int onAccept(ClientChannel &);
+**      int onData(ClientChannel &, const char *, size_t);
+**      int onWritable(ClientChannel &);
+**      void onClose(ClientChannel &);
+**      int handleRequest(ClientChannel &, HttpClient *, const char *, size_t);
+**      int addReply(ClientChannel &, HttpClient *, const char *, const char *, size_t, bool, const char *);
+**      static const char *headerValue(const char *, const char *, const char *);
+**      static void finishReplies(ClientChannel &, HttpClient *);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Lets the servers be measured with ordinary HTTP load tools
+** (-x http). Every request is answered with 200 and a fixed body:
+** HTTP_DEFAULT_BODY, or N bytes for a request for /bytes/N. Nothing is
+** looked up or generated per request; a kept-alive GET of the default
+** body is answered with one reply formatted at startup, and /bytes/N
+** bodies come from a buffer filled at startup.
+**
+** Requests are parsed as they arrive. A request head that lies wholly
+** inside a read is parsed where it lies; only one cut off by the end
+** of a read is copied until the rest comes in. Connections are kept
+** alive unless the client asks otherwise (or speaks HTTP/1.0 without
+** asking), and pipelined requests are answered in order, the replies
+** to one read going out in a single write. A request body announced by
+** Content-Length is skipped; chunked bodies are not supported.
+**
+** A client that asks to close, or sends something that cannot be
+** answered, gets its last reply and then a FIN once that reply has
+** been written; the server closes it when it hangs up in turn.
+**
+** Replies are handed to the channel whole, however large, so whatever
+** the socket cannot take at once must be kept: the client's Connection
+** queues it (connection.cpp) until the socket drains. A channel that
+** dropped it would cut a body short and leave the kept-alive client
+** reading the next reply from the wrong place.
+*************************************************************************/
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <cstring>
+#include "http.h"
+
+using namespace std;
+
+static const char *headerValue(const char *, const char *, const char *);
+static void finishReplies(ClientChannel &, HttpClient *);
+
+
+/*****************************************************************
+** Function: HttpHandler
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    HttpHandler()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Formats the default reply and fills the body buffer once, before
+** any worker starts.
+**********************************************************************/
+HttpHandler::HttpHandler()
+{
+    char head[256];
+
+    snprintf(head, sizeof(head), "HTTP/1.1 200 OK\r\nServer: 10KProblem\r\nContent-Type: text/plain\r\n"
+             "Content-Length: %zu\r\n\r\n", strlen(HTTP_DEFAULT_BODY));
+    defaultReply = string(head) + HTTP_DEFAULT_BODY;
+
+    body.assign(HTTP_MAX_BODY, 'x');
+}
+
+
+/*****************************************************************
+** Function: getName
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    const char *getName()
+**
+** Returns:
+**			const char * -- name -x selects the handler by
+**
+** Notes:
+** Names the HTTP handler.
+**********************************************************************/
+const char *HttpHandler::getName()
+{
+    return "http";
+}
+
+
+/*****************************************************************
+** Function: onAccept
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int onAccept(ClientChannel &client)
+**              ClientChannel &client -- newly accepted client
+**
+** Returns:
+**			int -- 0 to keep the client
+**
+** Notes:
+** Sets the client up to wait for its first request.
+**********************************************************************/
+int HttpHandler::onAccept(ClientChannel &client)
+{
+    HttpClient *http = new HttpClient();
+
+    http->bodyLeft = 0;
+    http->closing = false;
+    client.handlerState = http;
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: onData
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int onData(ClientChannel &client, const char *data, size_t length)
+**              ClientChannel &client -- client the bytes came from
+**              const char *data -- bytes received
+**              size_t length -- number of bytes
+**
+** Returns:
+**			int -- 0 to keep the client
+**              -- -1 if a reply could not be sent
+**
+** Notes:
+** Answers every request the read completes, then sends the replies.
+** Anything after a request that ends the connection is ignored.
+**********************************************************************/
+int HttpHandler::onData(ClientChannel &client, const char *data, size_t length)
+{
+    HttpClient *http = (HttpClient *) client.handlerState;
+
+    while (length > 0 && !http->closing)
+    {
+        const char *head;
+        size_t headLength;
+        size_t used;
+
+        //skip the body of the last request
+        if (http->bodyLeft > 0)
+        {
+            size_t skipped = http->bodyLeft < length ? http->bodyLeft : length;
+
+            data += skipped;
+            length -= skipped;
+            http->bodyLeft -= skipped;
+            continue;
+        }
+
+        if (http->partial.empty())
+        {
+            const char *end = (const char *) memmem(data, length, "\r\n\r\n", 4);
+
+            //head runs on into the next read
+            if (end == NULL)
+            {
+                http->partial.assign(data, data + length);
+                length = 0;
+                break;
+            }
+
+            head = data;
+            headLength = end + 4 - data;
+            used = headLength;
+        }
+        else
+        {
+            size_t had = http->partial.size();
+
+            //the blank line may straddle the two reads
+            http->partial.insert(http->partial.end(), data, data + length);
+            const char *start = http->partial.data() + (had >= 3 ? had - 3 : 0);
+            const char *end = (const char *) memmem(start, http->partial.data() + http->partial.size() - start, "\r\n\r\n", 4);
+
+            if (end == NULL)
+            {
+                length = 0;
+                break;
+            }
+
+            headLength = end + 4 - http->partial.data();
+            http->partial.resize(headLength);
+            head = http->partial.data();
+
+            //what follows the head is still in the read
+            used = headLength - had;
+        }
+
+        data += used;
+        length -= used;
+
+        if (handleRequest(client, http, head, headLength) == -1)
+        {
+            return -1;
+        }
+        http->partial.clear();
+    }
+
+    //a head too long to be a real request
+    if (!http->closing && http->partial.size() > HTTP_MAX_HEAD)
+    {
+        http->closing = true;
+        if (addReply(client, http, "431 Request Header Fields Too Large", "", 0, false, "Connection: close\r\n") == -1)
+        {
+            return -1;
+        }
+    }
+
+    if (!http->reply.empty())
+    {
+        if (client.sendData(http->reply.data(), http->reply.size()) == -1)
+        {
+            return -1;
+        }
+        http->reply.clear();
+    }
+
+    finishReplies(client, http);
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: onWritable
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int onWritable(ClientChannel &client)
+**              ClientChannel &client -- client whose queue emptied
+**
+** Returns:
+**			int -- 0 to keep the client
+**
+** Notes:
+** Ends a closing client's side of the connection once its last reply
+** has been written.
+**********************************************************************/
+int HttpHandler::onWritable(ClientChannel &client)
+{
+    finishReplies(client, (HttpClient *) client.handlerState);
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: onClose
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void onClose(ClientChannel &client)
+**              ClientChannel &client -- client being closed
+**
+** Returns:
+**			void
+**
+** Notes:
+** Frees the client's request state.
+**********************************************************************/
+void HttpHandler::onClose(ClientChannel &client)
+{
+    delete (HttpClient *) client.handlerState;
+    client.handlerState = NULL;
+}
+
+
+/*****************************************************************
+** Function: handleRequest
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int handleRequest(ClientChannel &client, HttpClient *http, const char *head, size_t headLength)
+**              ClientChannel &client -- client that sent the request
+**              HttpClient *http -- its state
+**              const char *head -- request line and headers
+**              size_t headLength -- their length, blank line included
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if the reply could not be sent
+**
+** Notes:
+** Reads the request line and the headers that matter here, and adds
+** the reply. A request that cannot be answered gets an error reply
+** and ends the connection.
+**********************************************************************/
+int HttpHandler::handleRequest(ClientChannel &client, HttpClient *http, const char *head, size_t headLength)
+{
+    const char *headEnd = head + headLength - 2;
+    const char *lineEnd = (const char *) memmem(head, headLength, "\r\n", 2);
+    const char *target = (const char *) memchr(head, ' ', lineEnd - head);
+    const char *version = target == NULL ? NULL : (const char *) memchr(target + 1, ' ', lineEnd - target - 1);
+    bool keepAlive;
+    bool sendBody;
+    size_t bodyLength = strlen(HTTP_DEFAULT_BODY);
+    const char *content = HTTP_DEFAULT_BODY;
+
+    //METHOD SP target SP HTTP/1.x
+    if (headLength > HTTP_MAX_HEAD)
+    {
+        http->closing = true;
+        return addReply(client, http, "431 Request Header Fields Too Large", "", 0, false, "Connection: close\r\n");
+    }
+    if (version == NULL || lineEnd - version != 9 || strncmp(version, " HTTP/1.", 8) != 0
+        || (version[8] != '0' && version[8] != '1'))
+    {
+        http->closing = true;
+        return addReply(client, http, "400 Bad Request", "", 0, false, "Connection: close\r\n");
+    }
+
+    keepAlive = version[8] == '1';
+    sendBody = !(target - head == 4 && strncmp(head, "HEAD", 4) == 0);
+    target++;
+
+    for (const char *line = lineEnd + 2; line < headEnd; line = lineEnd + 2)
+    {
+        const char *value;
+
+        lineEnd = (const char *) memmem(line, headEnd + 2 - line, "\r\n", 2);
+
+        if ((value = headerValue(line, lineEnd, "connection")) != NULL)
+        {
+            if (strncasecmp(value, "close", 5) == 0)
+            {
+                keepAlive = false;
+            }
+            else if (strncasecmp(value, "keep-alive", 10) == 0)
+            {
+                keepAlive = true;
+            }
+        }
+        else if ((value = headerValue(line, lineEnd, "content-length")) != NULL)
+        {
+            http->bodyLeft = strtoull(value, NULL, 10);
+        }
+        else if (headerValue(line, lineEnd, "transfer-encoding") != NULL)
+        {
+            http->closing = true;
+            return addReply(client, http, "501 Not Implemented", "", 0, false, "Connection: close\r\n");
+        }
+    }
+
+    //sized body: /bytes/N
+    if (version - target > 7 && strncmp(target, "/bytes/", 7) == 0)
+    {
+        char *numberEnd;
+
+        bodyLength = strtoul(target + 7, &numberEnd, 10);
+        if (numberEnd != version || bodyLength > HTTP_MAX_BODY)
+        {
+            http->closing = true;
+            return addReply(client, http, "400 Bad Request", "", 0, false, "Connection: close\r\n");
+        }
+        content = &body[0];
+    }
+    //the common case goes out as formatted at startup
+    else if (keepAlive && sendBody && version[8] == '1')
+    {
+        http->reply.insert(http->reply.end(), defaultReply.begin(), defaultReply.end());
+        return 0;
+    }
+
+    http->closing = !keepAlive;
+
+    if (!keepAlive)
+    {
+        return addReply(client, http, "200 OK", content, bodyLength, sendBody, "Connection: close\r\n");
+    }
+    return addReply(client, http, "200 OK", content, bodyLength, sendBody,
+                    version[8] == '0' ? "Connection: keep-alive\r\n" : "");
+}
+
+
+/*****************************************************************
+** Function: addReply
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int addReply(ClientChannel &client, HttpClient *http, const char *status,
+**                       const char *content, size_t contentLength, bool sendBody,
+**                       const char *connection)
+**              ClientChannel &client -- client to reply to
+**              HttpClient *http -- its state
+**              const char *status -- status code and reason
+**              const char *content -- body
+**              size_t contentLength -- its length
+**              bool sendBody -- false to leave the body out, as for HEAD
+**              const char *connection -- Connection header line, or ""
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if the client failed
+**
+** Notes:
+** Adds a reply behind the ones already waiting. A large body is not
+** copied: what is waiting goes out first and the body is sent from
+** where it lies.
+**********************************************************************/
+int HttpHandler::addReply(ClientChannel &client, HttpClient *http, const char *status, const char *content,
+                          size_t contentLength, bool sendBody, const char *connection)
+{
+    char head[256];
+    int headLength = snprintf(head, sizeof(head), "HTTP/1.1 %s\r\nServer: 10KProblem\r\nContent-Type: text/plain\r\n"
+                              "Content-Length: %zu\r\n%s\r\n", status, contentLength, connection);
+
+    http->reply.insert(http->reply.end(), head, head + headLength);
+
+    if (!sendBody || contentLength == 0)
+    {
+        return 0;
+    }
+
+    if (contentLength <= HTTP_COALESCE_LENGTH)
+    {
+        http->reply.insert(http->reply.end(), content, content + contentLength);
+        return 0;
+    }
+
+    if (client.sendData(http->reply.data(), http->reply.size()) == -1)
+    {
+        return -1;
+    }
+    http->reply.clear();
+
+    return client.sendData(content, contentLength);
+}
+
+
+/*****************************************************************
+** Function: headerValue
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static const char *headerValue(const char *line, const char *lineEnd, const char *name)
+**              const char *line -- header line
+**              const char *lineEnd -- its CRLF
+**              const char *name -- lower case header name
+**
+** Returns:
+**			const char * -- start of the value if the line is that header
+**              -- NULL if it is not
+**
+** Notes:
+** Header names are matched without regard to case.
+**********************************************************************/
+static const char *headerValue(const char *line, const char *lineEnd, const char *name)
+{
+    size_t nameLength = strlen(name);
+
+    if ((size_t) (lineEnd - line) <= nameLength || line[nameLength] != ':' || strncasecmp(line, name, nameLength) != 0)
+    {
+        return NULL;
+    }
+
+    line += nameLength + 1;
+    while (line < lineEnd && (*line == ' ' || *line == '\t'))
+    {
+        line++;
+    }
+
+    return line;
+}
+
+
+/*****************************************************************
+** Function: finishReplies
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void finishReplies(ClientChannel &client, HttpClient *http)
+**              ClientChannel &client -- client that may be closing
+**              HttpClient *http -- its state
+**
+** Returns:
+**			void
+**
+** Notes:
+** Sends a closing client a FIN once nothing is left to write, rather
+** than closing outright and losing the last reply.
+**********************************************************************/
+static void finishReplies(ClientChannel &client, HttpClient *http)
+{
+    if (http->closing && client.pendingOutput() == 0)
+    {
+        shutdown(client.getSocketValue(), SHUT_WR);
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef HTTP_H
+#define HTTP_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "handler.h"
+
+//body of a reply to any path but /bytes/N
+#define HTTP_DEFAULT_BODY "Hello, World!"
+
+//largest body /bytes/N may ask for
+#define HTTP_MAX_BODY (1024 * 1024)
+
+//longest request line and headers accepted
+#define HTTP_MAX_HEAD 8192
+
+//bodies up to this size are copied behind their headers, larger ones
+//are sent straight out of the preformatted body
+#define HTTP_COALESCE_LENGTH 4096
+
+/** What the HTTP handler keeps for each client **/
+struct HttpClient
+{
+    //start of a request head cut off by the end of a read
+    std::vector<char> partial;
+
+    //replies to the requests in one read, sent together
+    std::vector<char> reply;
+
+    //request body bytes still to be skipped
+    unsigned long long bodyLeft;
+
+    //last reply is out; close once it has been written
+    bool closing;
+};
+
+/** Answers HTTP/1.1 requests, kept alive and pipelined, from fixed bodies **/
+class HttpHandler : public Handler
+{
+    public:
+        HttpHandler();
+        const char *getName();
+
+        int onAccept(ClientChannel &);
+        int onData(ClientChannel &, const char *, size_t);
+        int onWritable(ClientChannel &);
+        void onClose(ClientChannel &);
+
+    private:
+        int handleRequest(ClientChannel &, HttpClient *, const char *, size_t);
+        int addReply(ClientChannel &, HttpClient *, const char *, const char *, size_t, bool, const char *);
+
+        //whole reply to a kept-alive GET of the default body
+        std::string defaultReply;
+
+        //filler /bytes/N replies are sent from
+        std::vector<char> body;
+};
+
+#endif //HTTP_H
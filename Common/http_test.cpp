@@ -0,0 +1,410 @@
+/**********************************************************************
+**	SOURCE FILE:	http_test.cpp - Tests for the HTTP handler's parser
+**
+**	PROGRAM:	Scalable Server -- unit tests
+**
+**	FUNCTIONS:
+**      int main();
+**      static int splitReplies(const std::string &, const char *,
+**                              std::vector<HttpReply> &);
+**      static void testPipelined();
+**      static void testSplitHead();
+**      static void testBodySkipped();
+**      static void testClosing();
+**      static void testBadRequests();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Feeds the HTTP handler requests through a channel that records what
+** it is sent instead of writing to a socket, then takes the replies
+** apart again. Run with make test.
+*************************************************************************/
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include "check.h"
+#include "http.h"
+
+using namespace std;
+
+/** Records everything sent to the client **/
+class TestChannel : public ClientChannel
+{
+    public:
+        TestChannel() : writes(0) {}
+
+        int getSocketValue() { return -1; }
+        int sendData(const char *data, size_t length)
+        {
+            sent.append(data, length);
+            writes++;
+            return 0;
+        }
+        size_t pendingOutput() { return 0; }
+
+        std::string sent;
+        int writes;
+};
+
+/** One reply taken back apart **/
+struct HttpReply
+{
+    int status;
+    bool closes;
+    std::string body;
+};
+
+static int splitReplies(const string &, const char *, vector<HttpReply> &);
+static void testPipelined();
+static void testSplitHead();
+static void testBodySkipped();
+static void testClosing();
+static void testBadRequests();
+
+
+/*****************************************************************
+** Function: main
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		     int main()
+**
+** Returns:
+**			int -- 0 if every check passed
+**              -- 1 otherwise
+**
+** Notes:
+** Runs every test.
+**********************************************************************/
+int main()
+{
+    testPipelined();
+    testSplitHead();
+    testBodySkipped();
+    testClosing();
+    testBadRequests();
+
+    return CHECK_RESULT("http");
+}
+
+
+/*****************************************************************
+** Function: splitReplies
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static int splitReplies(const string &sent, const char *withBody,
+**                                  vector<HttpReply> &replies)
+**              const string &sent -- everything the handler sent
+**              const char *withBody -- 'b' for each reply that carries
+**                                      its body, '-' for a HEAD reply
+**              vector<HttpReply> &replies -- gets the replies in order
+**
+** Returns:
+**			int -- 0 if sent was exactly that many whole replies
+**              -- -1 otherwise
+**
+** Notes:
+** Reads the replies back the way a client would, by Content-Length.
+**********************************************************************/
+static int splitReplies(const string &sent, const char *withBody, vector<HttpReply> &replies)
+{
+    size_t at = 0;
+
+    for (const char *kind = withBody; *kind != '\0'; kind++)
+    {
+        size_t headEnd = sent.find("\r\n\r\n", at);
+        if (headEnd == string::npos || sent.compare(at, 9, "HTTP/1.1 ") != 0)
+        {
+            return -1;
+        }
+
+        string head = sent.substr(at, headEnd + 4 - at);
+        size_t lengthAt = head.find("Content-Length: ");
+        if (lengthAt == string::npos)
+        {
+            return -1;
+        }
+
+        HttpReply reply;
+        reply.status = atoi(head.c_str() + 9);
+        reply.closes = head.find("Connection: close\r\n") != string::npos;
+
+        size_t bodyLength = *kind == 'b' ? strtoul(head.c_str() + lengthAt + 16, NULL, 10) : 0;
+        at = headEnd + 4;
+        if (sent.size() - at < bodyLength)
+        {
+            return -1;
+        }
+        reply.body = sent.substr(at, bodyLength);
+        at += bodyLength;
+
+        replies.push_back(reply);
+    }
+
+    return at == sent.size() ? 0 : -1;
+}
+
+
+/*****************************************************************
+** Function: testPipelined
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testPipelined()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Requests pipelined in one read are answered in order, in a single
+** write, and the connection is kept alive.
+**********************************************************************/
+static void testPipelined()
+{
+    HttpHandler handler;
+    TestChannel client;
+    vector<HttpReply> replies;
+    string requests = "GET / HTTP/1.1\r\nHost: x\r\n\r\n"
+                      "GET /bytes/5000 HTTP/1.1\r\nHost: x\r\n\r\n"
+                      "HEAD / HTTP/1.1\r\n\r\n"
+                      "GET /bytes/3 HTTP/1.0\r\nConnection: keep-alive\r\n\r\n";
+
+    CHECK(handler.onAccept(client) == 0);
+    CHECK(handler.onData(client, requests.data(), requests.size()) == 0);
+
+    CHECK(splitReplies(client.sent, "bb-b", replies) == 0);
+    CHECK(replies.size() == 4);
+    if (replies.size() == 4)
+    {
+        CHECK(replies[0].status == 200 && replies[0].body == HTTP_DEFAULT_BODY);
+        CHECK(replies[1].status == 200 && replies[1].body.size() == 5000);
+        CHECK(replies[2].status == 200 && replies[2].body.empty());
+        CHECK(replies[3].status == 200 && replies[3].body.size() == 3);
+        CHECK(!replies[0].closes && !replies[1].closes && !replies[2].closes && !replies[3].closes);
+    }
+
+    //the 5000-byte body goes out on its own rather than copied
+    CHECK(client.writes <= 3);
+
+    handler.onClose(client);
+}
+
+
+/*****************************************************************
+** Function: testSplitHead
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testSplitHead()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A request head cut at every byte, the blank line included, is
+** answered once the rest arrives, together with the request that
+** followed it in the same read.
+**********************************************************************/
+static void testSplitHead()
+{
+    string requests = "GET /bytes/2 HTTP/1.1\r\nHost: x\r\n\r\nGET / HTTP/1.1\r\n\r\n";
+    size_t firstLength = requests.find("GET /", 1);
+
+    for (size_t cut = 1; cut < firstLength; cut++)
+    {
+        HttpHandler handler;
+        TestChannel client;
+        vector<HttpReply> replies;
+
+        handler.onAccept(client);
+        CHECK(handler.onData(client, requests.data(), cut) == 0);
+        CHECK(client.sent.empty());
+
+        CHECK(handler.onData(client, requests.data() + cut, requests.size() - cut) == 0);
+        CHECK(splitReplies(client.sent, "bb", replies) == 0);
+        CHECK(replies.size() == 2 && replies[0].body == "xx" && replies[1].body == HTTP_DEFAULT_BODY);
+
+        handler.onClose(client);
+    }
+}
+
+
+/*****************************************************************
+** Function: testBodySkipped
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testBodySkipped()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A Content-Length body is skipped, even across reads, and the next
+** request after it is still answered.
+**********************************************************************/
+static void testBodySkipped()
+{
+    HttpHandler handler;
+    TestChannel client;
+    vector<HttpReply> replies;
+    string first = "POST / HTTP/1.1\r\nContent-Length: 16\r\n\r\nGET / ";
+    string second = "HTTP/1.1\r\n";
+    string third = "GET /bytes/1 HTTP/1.1\r\n\r\n";
+
+    handler.onAccept(client);
+    CHECK(handler.onData(client, first.data(), first.size()) == 0);
+    CHECK(handler.onData(client, second.data(), second.size()) == 0);
+    CHECK(handler.onData(client, third.data(), third.size()) == 0);
+
+    //"GET / HTTP/1.1\r\n" was the body; only the last GET is a request
+    CHECK(splitReplies(client.sent, "bb", replies) == 0);
+    CHECK(replies.size() == 2 && replies[0].status == 200 && replies[1].body == "x");
+
+    handler.onClose(client);
+}
+
+
+/*****************************************************************
+** Function: testClosing
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testClosing()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Connection: close, or HTTP/1.0 without keep-alive, gets a last
+** reply saying so, and requests pipelined behind it are ignored.
+**********************************************************************/
+static void testClosing()
+{
+    const char *requests[] = {
+        "GET / HTTP/1.1\r\nConnection: close\r\n\r\nGET / HTTP/1.1\r\n\r\n",
+        "GET / HTTP/1.0\r\n\r\nGET / HTTP/1.1\r\n\r\n"
+    };
+
+    for (int i = 0; i < 2; i++)
+    {
+        HttpHandler handler;
+        TestChannel client;
+        vector<HttpReply> replies;
+        string request = requests[i];
+
+        handler.onAccept(client);
+        CHECK(handler.onData(client, request.data(), request.size()) == 0);
+        CHECK(splitReplies(client.sent, "b", replies) == 0);
+        CHECK(replies.size() == 1 && replies[0].closes && replies[0].body == HTTP_DEFAULT_BODY);
+
+        handler.onClose(client);
+    }
+}
+
+
+/*****************************************************************
+** Function: testBadRequests
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testBadRequests()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A malformed request line, a chunked body, a /bytes/N past
+** HTTP_MAX_BODY and a head past HTTP_MAX_HEAD each get an error that
+** closes the connection.
+**********************************************************************/
+static void testBadRequests()
+{
+    string tooLong = "GET / HTTP/1.1\r\nX-Filler: " + string(HTTP_MAX_HEAD, 'f');
+    const char *requests[] = {
+        "GET /\r\n\r\n",
+        "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n",
+        "GET /bytes/99999999 HTTP/1.1\r\n\r\n",
+        tooLong.c_str()
+    };
+    const int statuses[] = {400, 501, 400, 431};
+
+    for (int i = 0; i < 4; i++)
+    {
+        HttpHandler handler;
+        TestChannel client;
+        vector<HttpReply> replies;
+        string request = requests[i];
+
+        handler.onAccept(client);
+        CHECK(handler.onData(client, request.data(), request.size()) == 0);
+        CHECK(splitReplies(client.sent, "b", replies) == 0);
+        CHECK(replies.size() == 1 && replies[0].status == statuses[i] && replies[0].closes);
+
+        handler.onClose(client);
+    }
+}
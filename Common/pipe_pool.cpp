@@ -0,0 +1,161 @@
+/**********************************************************************
+**	SOURCE FILE:	pipe_pool.cpp - Pool of splice pipes
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      PipePool();
+**      ~PipePool();
+**      bool acquire(int *);
+**      void release(int *);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Keeps a worker's empty pipes so the splice echo path does not
+** create and destroy a pipe for every client that falls behind.
+** Only empty pipes may be released back into the pool.
+*************************************************************************/
+#include <fcntl.h>
+#include <unistd.h>
+#include "pipe_pool.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: PipePool
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			PipePool()
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Base constructor for an empty pool.
+*********************************************************************/
+PipePool::PipePool()
+{
+}
+
+
+/*****************************************************************
+** Function: ~PipePool
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			~PipePool()
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Closes every pipe still in the pool.
+*********************************************************************/
+PipePool::~PipePool()
+{
+    for (size_t i = 0; i < freePipes.size(); i++)
+    {
+        close(freePipes[i]);
+    }
+}
+
+
+/*****************************************************************
+** Function: acquire
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			bool acquire(int *fds)
+**          int *fds -- receives the read and write ends
+**
+** Returns:
+**			bool -- true if a pipe was handed out
+**               -- false if a new pipe could not be created
+**
+** Notes:
+** Reuses an idle pipe if there is one, otherwise creates a
+** non-blocking one.
+*********************************************************************/
+bool PipePool::acquire(int *fds)
+{
+    if (!freePipes.empty())
+    {
+        fds[1] = freePipes.back();
+        freePipes.pop_back();
+        fds[0] = freePipes.back();
+        freePipes.pop_back();
+        return true;
+    }
+
+    return pipe2(fds, O_NONBLOCK | O_CLOEXEC) == 0;
+}
+
+
+/*****************************************************************
+** Function: release
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void release(int *fds)
+**          int *fds -- read and write ends of an empty pipe
+**
+** Returns:
+**			void
+**
+** Notes:
+** Keeps the pipe for reuse, or closes it once the pool already holds
+** PIPE_POOL_MAX pipes.
+*********************************************************************/
+void PipePool::release(int *fds)
+{
+    if (freePipes.size() >= PIPE_POOL_MAX * 2)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        return;
+    }
+
+    freePipes.push_back(fds[0]);
+    freePipes.push_back(fds[1]);
+}
@@ -0,0 +1,25 @@
+#ifndef PIPE_POOL_H
+#define PIPE_POOL_H
+
+#include <vector>
+
+//idle pipes a worker keeps around for reuse
+#define PIPE_POOL_MAX 64
+
+class PipePool
+{
+    public:
+        /** Initializers **/
+        PipePool();
+        ~PipePool();
+
+        /** Pipe management **/
+        bool acquire(int *);
+        void release(int *);
+
+    private:
+        //read and write ends of idle, empty pipes
+        std::vector<int> freePipes;
+};
+
+#endif //PIPE_POOL_H
@@ -0,0 +1,169 @@
+/**********************************************************************
+**	SOURCE FILE:	ready_scan.cpp - Finding the ready sockets select reported
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      ReadyScan(const fd_set *, int);
+**      int next();
+**      int highestDescriptor(const fd_set *, int);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** After select returns, testing every client with FD_ISSET costs the
+** same whether one of them is ready or all of them are. An fd_set is
+** an array of words with one bit per descriptor, so a scan can skip a
+** word with no bits set in a single compare, and find the lowest set
+** bit of any other with one count-trailing-zeros instruction. Sparse
+** readiness then costs a few instructions per word and per ready
+** socket rather than a call per client.
+**
+** The same layout lets highestDescriptor find the top of a set from
+** its highest non-empty word with one count-leading-zeros, which keeps
+** select's descriptor count down to the clients actually open.
+**
+** This relies on the glibc layout, where descriptor d is bit
+** d % READY_WORD_BITS of word d / READY_WORD_BITS.
+*************************************************************************/
+#include "ready_scan.h"
+
+static_assert(sizeof(fd_set) % sizeof(unsigned long) == 0, "fd_set is not made of whole words");
+
+
+/*****************************************************************
+** Function: ReadyScan
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    ReadyScan(const fd_set *set, int maxDescriptor)
+**              const fd_set *set -- set returned by select
+**              int maxDescriptor -- highest descriptor that may be set
+**
+** Returns:
+**			void
+**
+** Notes:
+** Starts a scan at the lowest descriptor. The set is read in place, so
+** it must not change until the scan is over.
+**********************************************************************/
+ReadyScan::ReadyScan(const fd_set *set, int maxDescriptor)
+{
+    words = (const unsigned long *) set;
+    wordCount = maxDescriptor < 0 ? 0 : maxDescriptor / READY_WORD_BITS + 1;
+    wordIndex = 0;
+    word = wordCount > 0 ? words[0] : 0;
+}
+
+
+/*****************************************************************
+** Function: next
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int next()
+**
+** Returns:
+**			int -- the next descriptor in the set, lowest first
+**              -- -1 once there are none left
+**
+** Notes:
+** Skips empty words whole, then takes the lowest bit of the first word
+** that has one and clears it.
+**********************************************************************/
+int ReadyScan::next()
+{
+    while (word == 0)
+    {
+        if (++wordIndex >= wordCount)
+        {
+            wordIndex = wordCount;
+            return -1;
+        }
+        word = words[wordIndex];
+    }
+
+    int bit = __builtin_ctzl(word);
+    word &= word - 1;
+
+    return wordIndex * READY_WORD_BITS + bit;
+}
+
+
+/*****************************************************************
+** Function: highestDescriptor
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int highestDescriptor(const fd_set *set, int limit)
+**              const fd_set *set -- set to search
+**              int limit -- highest descriptor that may be set
+**
+** Returns:
+**			int -- the highest descriptor in the set
+**              -- -1 if the set is empty
+**
+** Notes:
+** Searches down from limit a word at a time. Called when the highest
+** descriptor leaves the set, it usually stops in the first word.
+**********************************************************************/
+int highestDescriptor(const fd_set *set, int limit)
+{
+    const unsigned long *words = (const unsigned long *) set;
+
+    if (limit < 0)
+    {
+        return -1;
+    }
+
+    int wordIndex = limit / READY_WORD_BITS;
+    int topBit = limit % READY_WORD_BITS;
+
+    //ignore anything above the limit in its own word
+    unsigned long word = words[wordIndex];
+    if (topBit < READY_WORD_BITS - 1)
+    {
+        word &= (1UL << (topBit + 1)) - 1;
+    }
+
+    while (word == 0)
+    {
+        if (--wordIndex < 0)
+        {
+            return -1;
+        }
+        word = words[wordIndex];
+    }
+
+    return wordIndex * READY_WORD_BITS + READY_WORD_BITS - 1 - __builtin_clzl(word);
+}
@@ -0,0 +1,30 @@
+#ifndef READY_SCAN_H
+#define READY_SCAN_H
+
+#include <sys/select.h>
+
+//descriptors held by each word of an fd_set
+#define READY_WORD_BITS (8 * (int) sizeof(unsigned long))
+
+/** Walks the descriptors set in an fd_set a word at a time **/
+class ReadyScan
+{
+    public:
+        ReadyScan(const fd_set *, int);
+
+        /** Scanning **/
+        int next();
+
+    private:
+        //the set's words up to the one holding the highest descriptor
+        const unsigned long *words;
+        int wordCount;
+
+        //word being scanned, with the bits already returned cleared
+        int wordIndex;
+        unsigned long word;
+};
+
+int highestDescriptor(const fd_set *, int);
+
+#endif //READY_SCAN_H
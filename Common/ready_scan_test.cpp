@@ -0,0 +1,361 @@
+/**********************************************************************
+**	SOURCE FILE:	ready_scan_test.cpp - Tests for ReadyScan and
+**                                       highestDescriptor
+**
+**	PROGRAM:	Scalable Server -- unit tests
+**
+**	FUNCTIONS:
+**      int main();
+**      static bool scanMatches(const fd_set *, int);
+**      static void testEdges();
+**      static void testRandomSets();
+**      static int highestByHand(const fd_set *, int);
+**      static void testHighestEdges();
+**      static void testHighestRandom();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Checks the word-at-a-time scan and search against testing every
+** descriptor with FD_ISSET. Run with make test.
+*************************************************************************/
+#include <vector>
+#include <stdlib.h>
+#include "check.h"
+#include "ready_scan.h"
+
+using namespace std;
+
+static bool scanMatches(const fd_set *, int);
+static void testEdges();
+static void testRandomSets();
+static int highestByHand(const fd_set *, int);
+static void testHighestEdges();
+static void testHighestRandom();
+
+
+/*****************************************************************
+** Function: main
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		     int main()
+**
+** Returns:
+**			int -- 0 if every check passed
+**              -- 1 otherwise
+**
+** Notes:
+** Runs every test.
+**********************************************************************/
+int main()
+{
+    testEdges();
+    testRandomSets();
+    testHighestEdges();
+    testHighestRandom();
+
+    return CHECK_RESULT("ready_scan");
+}
+
+
+/*****************************************************************
+** Function: scanMatches
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static bool scanMatches(const fd_set *set, int maxDescriptor)
+**              const fd_set *set -- set to scan
+**              int maxDescriptor -- highest descriptor that may be set
+**
+** Returns:
+**			bool -- true if the scan found exactly what FD_ISSET does
+**
+** Notes:
+** Runs a ReadyScan to the end and compares it, in order, with every
+** descriptor up to maxDescriptor tested one at a time.
+**********************************************************************/
+static bool scanMatches(const fd_set *set, int maxDescriptor)
+{
+    vector<int> expected;
+    vector<int> found;
+    int sock;
+
+    for (int i = 0; i <= maxDescriptor; i++)
+    {
+        if (FD_ISSET(i, set))
+        {
+            expected.push_back(i);
+        }
+    }
+
+    ReadyScan scan(set, maxDescriptor);
+    while ((sock = scan.next()) >= 0)
+    {
+        found.push_back(sock);
+    }
+
+    //a finished scan stays finished
+    return found == expected && scan.next() == -1;
+}
+
+
+/*****************************************************************
+** Function: testEdges
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testEdges()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Empty sets, and descriptors at either end of a word and of the set.
+**********************************************************************/
+static void testEdges()
+{
+    fd_set set;
+
+    FD_ZERO(&set);
+    CHECK(scanMatches(&set, -1));
+    CHECK(scanMatches(&set, FD_SETSIZE - 1));
+
+    FD_SET(0, &set);
+    CHECK(scanMatches(&set, 0));
+
+    FD_SET(READY_WORD_BITS - 1, &set);
+    FD_SET(READY_WORD_BITS, &set);
+    FD_SET(2 * READY_WORD_BITS - 1, &set);
+    CHECK(scanMatches(&set, 2 * READY_WORD_BITS - 1));
+
+    FD_SET(FD_SETSIZE - 1, &set);
+    CHECK(scanMatches(&set, FD_SETSIZE - 1));
+
+    //only the last descriptor, many empty words in
+    FD_ZERO(&set);
+    FD_SET(FD_SETSIZE - 1, &set);
+    CHECK(scanMatches(&set, FD_SETSIZE - 1));
+}
+
+
+/*****************************************************************
+** Function: testRandomSets
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testRandomSets()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Sets from nearly empty to nearly full, each scanned up to the
+** highest descriptor a server could have put in it.
+**********************************************************************/
+static void testRandomSets()
+{
+    const int densities[] = {1, 10, 50, 90, 100};
+
+    srand(7);
+
+    for (int d = 0; d < 5; d++)
+    {
+        for (int round = 0; round < 200; round++)
+        {
+            fd_set set;
+            int maxDescriptor = rand() % FD_SETSIZE;
+
+            FD_ZERO(&set);
+            for (int i = 0; i <= maxDescriptor; i++)
+            {
+                if (rand() % 100 < densities[d])
+                {
+                    FD_SET(i, &set);
+                }
+            }
+
+            CHECK(scanMatches(&set, maxDescriptor));
+        }
+    }
+}
+
+
+
+/*****************************************************************
+** Function: highestByHand
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static int highestByHand(const fd_set *set, int limit)
+**              const fd_set *set -- set to search
+**              int limit -- highest descriptor to consider
+**
+** Returns:
+**			int -- the highest descriptor in the set up to limit
+**              -- -1 if there is none
+**
+** Notes:
+** Tests every descriptor from limit down with FD_ISSET.
+**********************************************************************/
+static int highestByHand(const fd_set *set, int limit)
+{
+    for (int i = limit; i >= 0; i--)
+    {
+        if (FD_ISSET(i, set))
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+
+/*****************************************************************
+** Function: testHighestEdges
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testHighestEdges()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Empty sets, a negative limit, descriptors above the limit in the
+** same word, and searches that cross down into earlier words.
+**********************************************************************/
+static void testHighestEdges()
+{
+    fd_set set;
+
+    FD_ZERO(&set);
+    CHECK(highestDescriptor(&set, -1) == -1);
+    CHECK(highestDescriptor(&set, 0) == -1);
+    CHECK(highestDescriptor(&set, FD_SETSIZE - 1) == -1);
+
+    FD_SET(0, &set);
+    CHECK(highestDescriptor(&set, -1) == -1);
+    CHECK(highestDescriptor(&set, 0) == 0);
+    CHECK(highestDescriptor(&set, FD_SETSIZE - 1) == 0);
+
+    //bits above the limit in its own word are not counted
+    FD_SET(5, &set);
+    FD_SET(9, &set);
+    CHECK(highestDescriptor(&set, 8) == 5);
+    CHECK(highestDescriptor(&set, 9) == 9);
+
+    //the top bit of a word, and the first bit of the next
+    FD_SET(READY_WORD_BITS - 1, &set);
+    CHECK(highestDescriptor(&set, READY_WORD_BITS - 1) == READY_WORD_BITS - 1);
+    CHECK(highestDescriptor(&set, READY_WORD_BITS - 2) == 9);
+    FD_SET(READY_WORD_BITS, &set);
+    CHECK(highestDescriptor(&set, READY_WORD_BITS) == READY_WORD_BITS);
+
+    //many empty words down to the answer
+    CHECK(highestDescriptor(&set, FD_SETSIZE - 1) == READY_WORD_BITS);
+
+    FD_SET(FD_SETSIZE - 1, &set);
+    CHECK(highestDescriptor(&set, FD_SETSIZE - 1) == FD_SETSIZE - 1);
+    CHECK(highestDescriptor(&set, FD_SETSIZE - 2) == READY_WORD_BITS);
+}
+
+
+/*****************************************************************
+** Function: testHighestRandom
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testHighestRandom()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Sparse random sets searched from random limits, so the answer is
+** sometimes in the limit's word and sometimes several words down.
+**********************************************************************/
+static void testHighestRandom()
+{
+    srand(11);
+
+    for (int round = 0; round < 1000; round++)
+    {
+        fd_set set;
+        int limit = rand() % FD_SETSIZE;
+
+        FD_ZERO(&set);
+        for (int i = 0; i < FD_SETSIZE; i++)
+        {
+            if (rand() % 200 == 0)
+            {
+                FD_SET(i, &set);
+            }
+        }
+
+        CHECK(highestDescriptor(&set, limit) == highestByHand(&set, limit));
+    }
+}
@@ -0,0 +1,299 @@
+/**********************************************************************
+**	SOURCE FILE:	stats.cpp - Shared memory worker counters
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+** WorkerStats * createSharedStats(int)
+** void countAccepted(WorkerStats *)
+** void countClosed(WorkerStats *)
+** void countBytes(WorkerStats *, unsigned long long)
+** void setUserBytes(WorkerStats *, unsigned long long)
+** StatsTotals sumStats(WorkerStats *, int)
+** void printSummary(const StatsTotals &, const StatsTotals &, double, double)
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Replaces the pipe messages the workers used to send the parent.
+** The parent maps one block of counters before forking and every
+** worker bumps its own cache-line-sized slot with relaxed atomics,
+** so counting a connection costs no system call and workers never
+** contend on a line. The parent reads the slots on a timer.
+*************************************************************************/
+#include <iostream>
+#include <new>
+#include <stdio.h>
+#include <sys/mman.h>
+#include "stats.h"
+
+using namespace std;
+
+/*****************************************************************
+** Function: createSharedStats
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    WorkerStats * createSharedStats(int slots)
+**              int slots -- number of worker slots
+**
+** Returns:
+**			WorkerStats * -- zeroed counters shared with children
+**                        -- NULL on a failure
+**
+** Notes:
+** Maps the counters as shared memory; must be called before forking.
+**********************************************************************/
+WorkerStats * createSharedStats(int slots)
+{
+    void *region = mmap(0, slots * sizeof(WorkerStats), PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (region == MAP_FAILED)
+    {
+        perror("mmap stats");
+        return NULL;
+    }
+
+    WorkerStats *stats = (WorkerStats *) region;
+    for (int i = 0; i < slots; i++)
+    {
+        new (&stats[i]) WorkerStats();
+        stats[i].accepted.store(0, memory_order_relaxed);
+        stats[i].closed.store(0, memory_order_relaxed);
+        stats[i].bytesEchoed.store(0, memory_order_relaxed);
+        stats[i].userBytes.store(0, memory_order_relaxed);
+    }
+
+    return stats;
+}
+
+/*****************************************************************
+** Function: countAccepted
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void countAccepted(WorkerStats *stats)
+**              WorkerStats *stats -- this worker's slot
+**
+** Returns:
+**			void
+**
+** Notes:
+** Counts a newly accepted client.
+**********************************************************************/
+void countAccepted(WorkerStats *stats)
+{
+    stats->accepted.fetch_add(1, memory_order_relaxed);
+}
+
+/*****************************************************************
+** Function: countClosed
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void countClosed(WorkerStats *stats)
+**              WorkerStats *stats -- this worker's slot
+**
+** Returns:
+**			void
+**
+** Notes:
+** Counts a client that has finished.
+**********************************************************************/
+void countClosed(WorkerStats *stats)
+{
+    stats->closed.fetch_add(1, memory_order_relaxed);
+}
+
+/*****************************************************************
+** Function: countBytes
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void countBytes(WorkerStats *stats, unsigned long long bytes)
+**              WorkerStats *stats -- this worker's slot
+**              unsigned long long bytes -- bytes echoed back
+**
+** Returns:
+**			void
+**
+** Notes:
+** Adds to the number of bytes echoed back to clients.
+**********************************************************************/
+void countBytes(WorkerStats *stats, unsigned long long bytes)
+{
+    stats->bytesEchoed.fetch_add(bytes, memory_order_relaxed);
+}
+
+/*****************************************************************
+** Function: setUserBytes
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void setUserBytes(WorkerStats *stats, unsigned long long bytes)
+**              WorkerStats *stats -- this worker's slot
+**              unsigned long long bytes -- user memory spent on clients
+**
+** Returns:
+**			void
+**
+** Notes:
+** Publishes how much memory the worker's clients cost it right now.
+** Unlike the counters this is a level, overwritten each time.
+**********************************************************************/
+void setUserBytes(WorkerStats *stats, unsigned long long bytes)
+{
+    stats->userBytes.store(bytes, memory_order_relaxed);
+}
+
+/*****************************************************************
+** Function: sumStats
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    StatsTotals sumStats(WorkerStats *stats, int slots)
+**              WorkerStats *stats -- shared counters
+**              int slots -- number of worker slots
+**
+** Returns:
+**			StatsTotals -- counters added up over all workers
+**
+** Notes:
+** Takes a snapshot of every worker's counters along with the spread
+** of open clients across workers. Slots are read independently, so
+** the totals may be a moment out of step.
+**********************************************************************/
+StatsTotals sumStats(WorkerStats *stats, int slots)
+{
+    StatsTotals totals = StatsTotals();
+
+    for (int i = 0; i < slots; i++)
+    {
+        unsigned long long accepted = stats[i].accepted.load(memory_order_relaxed);
+        unsigned long long closed = stats[i].closed.load(memory_order_relaxed);
+        unsigned long long active = accepted > closed ? accepted - closed : 0;
+
+        totals.accepted += accepted;
+        totals.closed += closed;
+        totals.bytesEchoed += stats[i].bytesEchoed.load(memory_order_relaxed);
+        totals.userBytes += stats[i].userBytes.load(memory_order_relaxed);
+
+        if (i == 0 || active < totals.minActive)
+        {
+            totals.minActive = active;
+        }
+        if (active > totals.maxActive)
+        {
+            totals.maxActive = active;
+        }
+    }
+
+    return totals;
+}
+
+/*****************************************************************
+** Function: printSummary
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void printSummary(const StatsTotals &now, const StatsTotals &last,
+**                            double interval, double uptime)
+**              const StatsTotals &now -- counters from this sample
+**              const StatsTotals &last -- counters from the previous sample
+**              double interval -- seconds between the two samples
+**              double uptime -- seconds since the server started
+**
+** Returns:
+**			void
+**
+** Notes:
+** Prints one line summarising the interval: open clients, total
+** clients, accept rate, bytes echoed and the spread of open clients
+** across workers, followed by the user memory per open client when the
+** workers report it.
+**********************************************************************/
+void printSummary(const StatsTotals &now, const StatsTotals &last, double interval, double uptime)
+{
+    if (interval <= 0)
+    {
+        interval = 1;
+    }
+
+    double acceptRate = (now.accepted - last.accepted) / interval;
+    double echoRate = (now.bytesEchoed - last.bytesEchoed) / interval;
+
+    unsigned long long open = now.accepted - now.closed;
+
+    printf("[%8.1fs] current %llu | total %llu | %.1f accepts/s | %.1f MB echoed (%.2f MB/s) | per-worker %llu-%llu",
+           uptime, open, now.accepted, acceptRate,
+           now.bytesEchoed / 1048576.0, echoRate / 1048576.0, now.minActive, now.maxActive);
+    if (now.userBytes > 0 && open > 0)
+    {
+        printf(" | %llu B/client", now.userBytes / open);
+    }
+    printf("\n");
+    fflush(stdout);
+}
@@ -0,0 +1,42 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <atomic>
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
+
+/** One worker's counters, alone on its cache line **/
+struct alignas(CACHE_LINE_SIZE) WorkerStats
+{
+    std::atomic<unsigned long long> accepted;
+    std::atomic<unsigned long long> closed;
+    std::atomic<unsigned long long> bytesEchoed;
+
+    //user memory the worker spends on its clients, if it keeps count
+    std::atomic<unsigned long long> userBytes;
+};
+
+/** Counters summed across every worker **/
+struct StatsTotals
+{
+    unsigned long long accepted;
+    unsigned long long closed;
+    unsigned long long bytesEchoed;
+    unsigned long long userBytes;
+
+    //fewest and most open clients on any one worker
+    unsigned long long minActive;
+    unsigned long long maxActive;
+};
+
+WorkerStats * createSharedStats(int);
+void countAccepted(WorkerStats *);
+void countClosed(WorkerStats *);
+void countBytes(WorkerStats *, unsigned long long);
+void setUserBytes(WorkerStats *, unsigned long long);
+StatsTotals sumStats(WorkerStats *, int);
+void printSummary(const StatsTotals &, const StatsTotals &, double, double);
+
+#endif //STATS_H
@@ -0,0 +1,230 @@
+/**********************************************************************
+**	SOURCE FILE:	supervisor.cpp - Worker process supervision
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+** void recordSpawn(WorkerRecord &, pid_t, unsigned long long)
+** int superviseWorkers(std::vector<WorkerRecord> &, WorkerStats *, WorkerSpawner)
+** int runningWorkers(std::vector<WorkerRecord> &)
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Keeps the parent's pool of workers at full strength. Dead workers
+** are reaped with waitpid, the reason is logged and a replacement is
+** forked into the same slot after a delay that doubles each time the
+** slot dies young, so a worker that crashes on startup cannot turn
+** the parent into a fork loop. The replacement reuses the slot's
+** shared counters; the clients the dead worker still held are counted
+** as closed, since the kernel closed them with it.
+**
+** While the server drains it passes no spawner: workers are still
+** reaped, but their slots stay empty.
+*************************************************************************/
+#include <iostream>
+#include <cstring>
+#include <stdio.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include "timer_wheel.h"
+#include "supervisor.h"
+
+using namespace std;
+
+/*****************************************************************
+** Function: recordSpawn
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void recordSpawn(WorkerRecord &worker, pid_t pid, unsigned long long now)
+**              WorkerRecord &worker -- slot the worker was forked into
+**              pid_t pid -- the new worker's process id
+**              unsigned long long now -- current time in milliseconds
+**
+** Returns:
+**			void
+**
+** Notes:
+** Notes a newly forked worker in its slot.
+**********************************************************************/
+void recordSpawn(WorkerRecord &worker, pid_t pid, unsigned long long now)
+{
+    worker.pid = pid;
+    worker.startedAt = now;
+
+    if (worker.backoff == 0)
+    {
+        worker.backoff = RESPAWN_BACKOFF_MS;
+    }
+}
+
+/*****************************************************************
+** Function: superviseWorkers
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int superviseWorkers(std::vector<WorkerRecord> &workers,
+**                               WorkerStats *stats, WorkerSpawner spawn)
+**              std::vector<WorkerRecord> &workers -- one record per slot
+**              WorkerStats *stats -- shared counters, one per slot
+**              WorkerSpawner spawn -- forks the worker for a slot,
+**                                 NULL to only reap
+**
+** Returns:
+**			int -- number of workers replaced
+**
+** Notes:
+** Reaps every worker that has exited, then replaces those whose
+** back-off has run out. Call it regularly from the parent.
+**********************************************************************/
+int superviseWorkers(vector<WorkerRecord> &workers, WorkerStats *stats, WorkerSpawner spawn)
+{
+    unsigned long long now = monotonicMillis();
+    int status;
+    pid_t pid;
+    int replaced = 0;
+
+    //reap the dead
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0)
+    {
+        for (int i = 0; i < (int) workers.size(); i++)
+        {
+            WorkerRecord &worker = workers[i];
+            if (worker.pid != pid)
+            {
+                continue;
+            }
+
+            //a worker that had been up a while was not crash looping
+            if (now - worker.startedAt >= RESPAWN_STABLE_MS)
+            {
+                worker.backoff = RESPAWN_BACKOFF_MS;
+            }
+
+            worker.pid = 0;
+            worker.lastStatus = status;
+
+            //the dead worker's clients went with it
+            stats[i].closed.store(stats[i].accepted.load(memory_order_relaxed), memory_order_relaxed);
+            stats[i].userBytes.store(0, memory_order_relaxed);
+            worker.respawnAt = now + worker.backoff;
+
+            //draining; only a worker that did not finish cleanly is news
+            if (spawn == NULL)
+            {
+                if (WIFSIGNALED(status))
+                {
+                    fprintf(stderr, "Worker %d (pid %d) killed by signal %d (%s) while draining\n",
+                            i, (int) pid, WTERMSIG(status), strsignal(WTERMSIG(status)));
+                }
+                else if (WEXITSTATUS(status) != 0)
+                {
+                    fprintf(stderr, "Worker %d (pid %d) exited with status %d while draining\n",
+                            i, (int) pid, WEXITSTATUS(status));
+                }
+                break;
+            }
+
+            if (WIFSIGNALED(status))
+            {
+                fprintf(stderr, "Worker %d (pid %d) killed by signal %d (%s); restarting in %d ms\n",
+                        i, (int) pid, WTERMSIG(status), strsignal(WTERMSIG(status)), worker.backoff);
+            }
+            else
+            {
+                fprintf(stderr, "Worker %d (pid %d) exited with status %d; restarting in %d ms\n",
+                        i, (int) pid, WEXITSTATUS(status), worker.backoff);
+            }
+
+            //back off harder if it keeps dying
+            worker.backoff *= 2;
+            if (worker.backoff > RESPAWN_BACKOFF_MAX_MS)
+            {
+                worker.backoff = RESPAWN_BACKOFF_MAX_MS;
+            }
+            break;
+        }
+    }
+
+    //replace the ones whose wait is over
+    for (int i = 0; spawn != NULL && i < (int) workers.size(); i++)
+    {
+        WorkerRecord &worker = workers[i];
+        if (worker.pid != 0 || now < worker.respawnAt)
+        {
+            continue;
+        }
+
+        if (spawn(i) == -1)
+        {
+            //try again after another back-off
+            worker.respawnAt = now + worker.backoff;
+            continue;
+        }
+
+        worker.restarts++;
+        replaced++;
+    }
+
+    return replaced;
+}
+
+/*****************************************************************
+** Function: runningWorkers
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int runningWorkers(std::vector<WorkerRecord> &workers)
+**              std::vector<WorkerRecord> &workers -- one record per slot
+**
+** Returns:
+**			int -- number of workers that have not been reaped
+**
+** Notes:
+** Lets a draining parent know when the last worker is gone.
+**********************************************************************/
+int runningWorkers(vector<WorkerRecord> &workers)
+{
+    int running = 0;
+
+    for (int i = 0; i < (int) workers.size(); i++)
+    {
+        if (workers[i].pid > 0)
+        {
+            running++;
+        }
+    }
+
+    return running;
+}
@@ -0,0 +1,39 @@
+#ifndef SUPERVISOR_H
+#define SUPERVISOR_H
+
+#include <vector>
+#include <sys/types.h>
+#include "stats.h"
+
+//first delay before a dead worker is replaced, and the most it grows to
+#define RESPAWN_BACKOFF_MS 100
+#define RESPAWN_BACKOFF_MAX_MS 30000
+
+//a worker that ran this long before dying starts over at the first delay
+#define RESPAWN_STABLE_MS 10000
+
+//longest the parent sleeps between checks on its workers
+#define SUPERVISE_INTERVAL_MS 100
+
+/** What the parent knows about one worker process **/
+struct WorkerRecord
+{
+    //0 while the worker is dead and waiting to be replaced
+    pid_t pid;
+
+    unsigned long long startedAt;
+    unsigned long long respawnAt;
+    int backoff;
+
+    int restarts;
+    int lastStatus;
+};
+
+/** Forks the worker for a slot; returns its pid or -1 **/
+typedef pid_t (*WorkerSpawner)(int);
+
+void recordSpawn(WorkerRecord &, pid_t, unsigned long long);
+int superviseWorkers(std::vector<WorkerRecord> &, WorkerStats *, WorkerSpawner);
+int runningWorkers(std::vector<WorkerRecord> &);
+
+#endif //SUPERVISOR_H
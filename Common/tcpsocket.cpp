@@ -6,7 +6,7 @@
 **	FUNCTIONS:
 **      TCPSocket(int);
 **      TCPSocket();
-**      bool connectServer(int);
+**      bool connectServer(int, bool, std::string);
 **      bool connectClient(int, string);
 **      bool startListen(int);
 **      int getPort();
@@ -125,17 +125,20 @@ TCPSocket::TCPSocket(int sockVal)
 ** Programmer: Rhea Lauzon
 **
 ** Interface:
-**			bool connectServer(int portNum)
+**			bool connectServer(int portNum, bool reusePort, std::string address)
 **          int portNum -- port to connect to
+**          bool reusePort -- true to set SO_REUSEPORT before binding
+**          std::string address -- IPv4 address to bind, empty for any
 **
 ** Returns:
 **			bool -- true if the socket is able to bind successfully
 **               -- false if there is issues
 ** Notes:
 ** Creates a TCP socket server-style, that is, for other clients to
-** connect to.
+** connect to. With reusePort set several sockets can bind the same
+** port and the kernel spreads new connections across them.
 *********************************************************************/
-bool TCPSocket::connectServer(int portNum)
+bool TCPSocket::connectServer(int portNum, bool reusePort, std::string address)
 {
     port = portNum;
 
@@ -155,11 +158,25 @@ bool TCPSocket::connectServer(int portNum)
         return false;
     }
 
+    //set REUSEPORT so each worker can bind its own listener
+    if (reusePort && setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &arg, sizeof(int)) == -1)
+    {
+        cerr << "Failed to set SO_REUSEPORT." << endl;
+        return false;
+    }
+
     //setup the server address structur
     serverAddress.sin_family = AF_INET;
     serverAddress.sin_port = htons(port);
     serverAddress.sin_addr.s_addr = htonl(INADDR_ANY);
 
+    //or only the address asked for
+    if (!address.empty() && inet_pton(AF_INET, address.c_str(), &serverAddress.sin_addr) != 1)
+    {
+        cerr << "Invalid listen address: " << address << endl;
+        return false;
+    }
+
     //bind the address
     if (bind(sock, (struct sockaddr *) &serverAddress, sizeof(serverAddress)) == -1)
     {
@@ -3,6 +3,7 @@
 
 #define BUFFER_LENGTH 1025
 
+#include <string>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <arpa/inet.h>
@@ -16,7 +17,7 @@ class TCPSocket
         TCPSocket(int);
         TCPSocket();
 
-        bool connectServer(int);
+        bool connectServer(int, bool reusePort = false, std::string address = "");
         bool connectClient(int, std::string);
         bool startListen(int);
 
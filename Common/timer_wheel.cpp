@@ -0,0 +1,471 @@
+/**********************************************************************
+**	SOURCE FILE:	timer_wheel.cpp - Hierarchical timer wheel
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      TimerWheel();
+**      void start(unsigned long long);
+**      void schedule(TimerNode *, unsigned long long);
+**      void cancel(TimerNode *);
+**      bool isScheduled(TimerNode *);
+**      int advance(unsigned long long, void (*)(void *));
+**      int nextTimeout(unsigned long long);
+**      void insert(TimerNode *);
+**      void cascade(int);
+**      unsigned long long monotonicMillis();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Per-worker timers for connection deadlines. Time is counted in
+** ticks of TIMER_TICK_MS. Level 0 has one slot per tick; each level
+** above it has slots TIMER_WHEEL_SLOTS times as wide. A timer goes
+** in the lowest level whose range covers its deadline, and when the
+** level below wraps around, the next slot of the level above is
+** cascaded down. Scheduling, cancelling and expiring a timer are all
+** O(1), and the timers are linked through nodes embedded in their
+** owners so the wheel never allocates.
+*************************************************************************/
+#include <cstddef>
+#include <time.h>
+#include "timer_wheel.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: TimerWheel
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			TimerWheel()
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Base constructor for an empty wheel starting at tick 0.
+*********************************************************************/
+TimerWheel::TimerWheel()
+{
+    start(0);
+}
+
+
+/*****************************************************************
+** Function: start
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void start(unsigned long long now)
+**          unsigned long long now -- current time in milliseconds
+**
+** Returns:
+**			void
+**
+** Notes:
+** Empties the wheel and sets its clock.
+*********************************************************************/
+void TimerWheel::start(unsigned long long now)
+{
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; level++)
+    {
+        for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++)
+        {
+            slots[level][slot].next = &slots[level][slot];
+            slots[level][slot].prev = &slots[level][slot];
+        }
+    }
+
+    currentTick = now / TIMER_TICK_MS;
+    scheduled = 0;
+}
+
+
+/*****************************************************************
+** Function: schedule
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void schedule(TimerNode *node, unsigned long long deadline)
+**          TimerNode *node -- timer to (re)schedule
+**          unsigned long long deadline -- expiry time in milliseconds
+**
+** Returns:
+**			void
+**
+** Notes:
+** Sets a timer to fire on the first tick at or after the deadline,
+** moving it if it was already scheduled.
+*********************************************************************/
+void TimerWheel::schedule(TimerNode *node, unsigned long long deadline)
+{
+    if (isScheduled(node))
+    {
+        cancel(node);
+    }
+
+    node->expiryTick = (deadline + TIMER_TICK_MS - 1) / TIMER_TICK_MS;
+
+    //deadlines in the past fire on the next tick
+    if (node->expiryTick <= currentTick)
+    {
+        node->expiryTick = currentTick + 1;
+    }
+
+    insert(node);
+    scheduled++;
+}
+
+
+/*****************************************************************
+** Function: cancel
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void cancel(TimerNode *node)
+**          TimerNode *node -- timer to stop
+**
+** Returns:
+**			void
+**
+** Notes:
+** Unlinks a timer from its slot. Does nothing if it is not scheduled.
+*********************************************************************/
+void TimerWheel::cancel(TimerNode *node)
+{
+    if (!isScheduled(node))
+    {
+        return;
+    }
+
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->next = node->prev = NULL;
+    scheduled--;
+}
+
+
+/*****************************************************************
+** Function: isScheduled
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			bool isScheduled(TimerNode *node)
+**          TimerNode *node -- timer to check
+**
+** Returns:
+**			bool -- true if the timer is waiting to fire
+**
+** Notes:
+** Unscheduled nodes must have a NULL next pointer.
+*********************************************************************/
+bool TimerWheel::isScheduled(TimerNode *node)
+{
+    return node->next != NULL;
+}
+
+
+/*****************************************************************
+** Function: advance
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int advance(unsigned long long now, void (*expire)(void *))
+**          unsigned long long now -- current time in milliseconds
+**          void (*expire)(void *) -- called with the owner of each
+**                                    expired timer
+**
+** Returns:
+**			int -- number of timers that expired
+**
+** Notes:
+** Moves the wheel up to the current time one tick at a time,
+** cascading the outer levels as the inner ones wrap and expiring the
+** timers in each level 0 slot passed. The callback may reschedule
+** or cancel any timer.
+*********************************************************************/
+int TimerWheel::advance(unsigned long long now, void (*expire)(void *))
+{
+    unsigned long long targetTick = now / TIMER_TICK_MS;
+    int expired = 0;
+
+    while (currentTick < targetTick)
+    {
+        currentTick++;
+
+        //level 0 wrapped; pull the next slot of the level above down
+        if ((currentTick & (TIMER_WHEEL_SLOTS - 1)) == 0)
+        {
+            cascade(1);
+        }
+
+        TimerNode *slot = &slots[0][currentTick & (TIMER_WHEEL_SLOTS - 1)];
+
+        //detach the slot so callbacks can safely reschedule
+        TimerNode due;
+        if (slot->next == slot)
+        {
+            continue;
+        }
+        due.next = slot->next;
+        due.prev = slot->prev;
+        due.next->prev = &due;
+        due.prev->next = &due;
+        slot->next = slot->prev = slot;
+
+        while (due.next != &due)
+        {
+            TimerNode *node = due.next;
+            cancel(node);
+            expired++;
+            expire(node->owner);
+        }
+    }
+
+    return expired;
+}
+
+
+/*****************************************************************
+** Function: nextTimeout
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int nextTimeout(unsigned long long now)
+**          unsigned long long now -- current time in milliseconds
+**
+** Returns:
+**			int -- milliseconds until the wheel next needs advancing
+**              -- -1 if no timers are scheduled
+**
+** Notes:
+** Suitable as the timeout for epoll_wait or select. Looks for the
+** next occupied level 0 slot, or the next cascade if level 0 is empty.
+*********************************************************************/
+int TimerWheel::nextTimeout(unsigned long long now)
+{
+    if (scheduled == 0)
+    {
+        return -1;
+    }
+
+    unsigned long long tick = currentTick + 1;
+
+    //stop at the first timer or the next time level 0 wraps
+    while ((tick & (TIMER_WHEEL_SLOTS - 1)) != 0)
+    {
+        TimerNode *slot = &slots[0][tick & (TIMER_WHEEL_SLOTS - 1)];
+        if (slot->next != slot)
+        {
+            break;
+        }
+        tick++;
+    }
+
+    unsigned long long due = tick * TIMER_TICK_MS;
+    return due > now ? (int) (due - now) : 0;
+}
+
+
+/*****************************************************************
+** Function: insert
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void insert(TimerNode *node)
+**          TimerNode *node -- timer with its expiry tick set
+**
+** Returns:
+**			void
+**
+** Notes:
+** Links a timer into the lowest level that can hold its deadline.
+** Deadlines past the range of the outermost level are parked at its
+** far end and re-placed when they cascade.
+*********************************************************************/
+void TimerWheel::insert(TimerNode *node)
+{
+    unsigned long long delta = node->expiryTick - currentTick;
+    unsigned long long placeTick = node->expiryTick;
+    int level = 0;
+
+    while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (1ULL << (TIMER_WHEEL_BITS * (level + 1))))
+    {
+        level++;
+    }
+
+    //further out than the whole wheel
+    unsigned long long range = 1ULL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS);
+    if (delta >= range)
+    {
+        placeTick = currentTick + range - 1;
+    }
+
+    TimerNode *slot = &slots[level][(placeTick >> (TIMER_WHEEL_BITS * level)) & (TIMER_WHEEL_SLOTS - 1)];
+
+    node->next = slot;
+    node->prev = slot->prev;
+    slot->prev->next = node;
+    slot->prev = node;
+}
+
+
+/*****************************************************************
+** Function: cascade
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void cascade(int level)
+**          int level -- level whose current slot is redistributed
+**
+** Returns:
+**			void
+**
+** Notes:
+** Re-places every timer in the current slot of a level into the
+** levels below it, then carries on upward if this level also wrapped.
+*********************************************************************/
+void TimerWheel::cascade(int level)
+{
+    if (level >= TIMER_WHEEL_LEVELS)
+    {
+        return;
+    }
+
+    int index = (currentTick >> (TIMER_WHEEL_BITS * level)) & (TIMER_WHEEL_SLOTS - 1);
+    TimerNode *slot = &slots[level][index];
+
+    //detach the slot before re-placing its timers
+    TimerNode moving;
+    if (slot->next != slot)
+    {
+        moving.next = slot->next;
+        moving.prev = slot->prev;
+        moving.next->prev = &moving;
+        moving.prev->next = &moving;
+        slot->next = slot->prev = slot;
+
+        while (moving.next != &moving)
+        {
+            TimerNode *node = moving.next;
+            moving.next = node->next;
+            node->next->prev = &moving;
+            insert(node);
+        }
+    }
+
+    if (index == 0)
+    {
+        cascade(level + 1);
+    }
+}
+
+
+/*****************************************************************
+** Function: monotonicMillis
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			unsigned long long monotonicMillis()
+**
+** Returns:
+**			unsigned long long -- milliseconds on the monotonic clock
+**
+** Notes:
+** Clock used for every deadline in the wheel.
+*********************************************************************/
+unsigned long long monotonicMillis()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
@@ -0,0 +1,50 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+//milliseconds per tick of the innermost wheel
+#define TIMER_TICK_MS 100
+
+//slots per level (power of 2) and number of levels
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS 4
+
+/** A timer embedded in the object it belongs to **/
+struct TimerNode
+{
+    TimerNode *next;
+    TimerNode *prev;
+    unsigned long long expiryTick;
+    void *owner;
+};
+
+class TimerWheel
+{
+    public:
+        /** Initializers **/
+        TimerWheel();
+        void start(unsigned long long);
+
+        /** Timers **/
+        void schedule(TimerNode *, unsigned long long);
+        void cancel(TimerNode *);
+        bool isScheduled(TimerNode *);
+
+        /** Ticking **/
+        int advance(unsigned long long, void (*)(void *));
+        int nextTimeout(unsigned long long);
+
+    private:
+        void insert(TimerNode *);
+        void cascade(int);
+
+        //one circular list head per slot
+        TimerNode slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+
+        unsigned long long currentTick;
+        int scheduled;
+};
+
+unsigned long long monotonicMillis();
+
+#endif //TIMER_WHEEL_H
@@ -0,0 +1,383 @@
+/**********************************************************************
+**	SOURCE FILE:	timer_wheel_test.cpp - Tests for TimerWheel
+**
+**	PROGRAM:	Scalable Server -- unit tests
+**
+**	FUNCTIONS:
+**      int main();
+**      static void recordExpiry(void *);
+**      static void expireOrPushBack(void *);
+**      static void testCascading();
+**      static void testCancel();
+**      static void testReschedule();
+**      static void testNextTimeout();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Drives a TimerWheel with made-up times instead of the clock, so
+** weeks of ticks run in a moment. Run with make test.
+*************************************************************************/
+#include "check.h"
+#include "timer_wheel.h"
+
+using namespace std;
+
+/** A timer and the tick it went off on **/
+struct TestTimer
+{
+    TimerNode node;
+    unsigned long long deadline;
+    unsigned long long firedAt;
+    int fired;
+};
+
+//wheel under test and the time handed to its last advance
+TimerWheel *testWheel;
+unsigned long long testNow;
+
+static void recordExpiry(void *);
+static void expireOrPushBack(void *);
+static void testCascading();
+static void testCancel();
+static void testReschedule();
+static void testNextTimeout();
+
+
+/*****************************************************************
+** Function: main
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		     int main()
+**
+** Returns:
+**			int -- 0 if every check passed
+**              -- 1 otherwise
+**
+** Notes:
+** Runs every test.
+**********************************************************************/
+int main()
+{
+    testCascading();
+    testCancel();
+    testReschedule();
+    testNextTimeout();
+
+    return CHECK_RESULT("timer_wheel");
+}
+
+
+/*****************************************************************
+** Function: recordExpiry
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void recordExpiry(void *owner)
+**              void *owner -- TestTimer that went off
+**
+** Returns:
+**			void
+**
+** Notes:
+** Notes when the timer went off, and how many times.
+**********************************************************************/
+static void recordExpiry(void *owner)
+{
+    TestTimer *timer = (TestTimer *) owner;
+
+    timer->firedAt = testNow;
+    timer->fired++;
+}
+
+
+/*****************************************************************
+** Function: expireOrPushBack
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void expireOrPushBack(void *owner)
+**              void *owner -- TestTimer that went off
+**
+** Returns:
+**			void
+**
+** Notes:
+** Pushes the timer back if its deadline has since moved on, as a
+** server does for a client that was active in the meantime, and
+** records it as gone off otherwise.
+**********************************************************************/
+static void expireOrPushBack(void *owner)
+{
+    TestTimer *timer = (TestTimer *) owner;
+
+    if (timer->deadline > testNow)
+    {
+        testWheel->schedule(&timer->node, timer->deadline);
+        return;
+    }
+
+    recordExpiry(owner);
+}
+
+
+/*****************************************************************
+** Function: testCascading
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testCascading()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Timers on every level, either side of each level's edge and past
+** the whole wheel, each go off once, on the first tick at or after
+** their deadline. The wheel starts part way through its slots so the
+** cascades do not line up with the start.
+**********************************************************************/
+static void testCascading()
+{
+    const unsigned long long offsets[] = {
+        1, 5, 63, 64, 65, 100, 4095, 4096, 4097, 5000,
+        262143, 262144, 262145, 300000, 16777215, 16777216, 16777300
+    };
+    const int count = sizeof(offsets) / sizeof(offsets[0]);
+    const unsigned long long startTick = 123457;
+
+    TimerWheel wheel;
+    TestTimer timers[count];
+
+    wheel.start(startTick * TIMER_TICK_MS);
+
+    for (int i = 0; i < count; i++)
+    {
+        timers[i].node.next = timers[i].node.prev = NULL;
+        timers[i].node.owner = &timers[i];
+        timers[i].deadline = (startTick + offsets[i]) * TIMER_TICK_MS;
+        timers[i].fired = 0;
+        wheel.schedule(&timers[i].node, timers[i].deadline);
+    }
+
+    unsigned long long lastTick = startTick + offsets[count - 1] + 2;
+    for (unsigned long long tick = startTick + 1; tick <= lastTick; tick++)
+    {
+        testNow = tick * TIMER_TICK_MS;
+        wheel.advance(testNow, recordExpiry);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        CHECK(timers[i].fired == 1);
+        CHECK(timers[i].firedAt == timers[i].deadline);
+        CHECK(!wheel.isScheduled(&timers[i].node));
+    }
+    CHECK(wheel.nextTimeout(testNow) == -1);
+}
+
+
+/*****************************************************************
+** Function: testCancel
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testCancel()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A cancelled timer never goes off, cancelling it twice is harmless,
+** and a deadline part way through a tick waits for the end of it.
+**********************************************************************/
+static void testCancel()
+{
+    TimerWheel wheel;
+    TestTimer kept;
+    TestTimer dropped;
+
+    wheel.start(0);
+
+    kept.node.next = kept.node.prev = NULL;
+    kept.node.owner = &kept;
+    kept.fired = 0;
+    dropped.node.next = dropped.node.prev = NULL;
+    dropped.node.owner = &dropped;
+    dropped.fired = 0;
+
+    wheel.schedule(&kept.node, 7050);
+    wheel.schedule(&dropped.node, 7050);
+    CHECK(wheel.isScheduled(&dropped.node));
+
+    wheel.cancel(&dropped.node);
+    wheel.cancel(&dropped.node);
+    CHECK(!wheel.isScheduled(&dropped.node));
+
+    testNow = 7000;
+    CHECK(wheel.advance(testNow, recordExpiry) == 0);
+    CHECK(kept.fired == 0);
+
+    testNow = 7100;
+    CHECK(wheel.advance(testNow, recordExpiry) == 1);
+    CHECK(kept.fired == 1);
+    CHECK(dropped.fired == 0);
+}
+
+
+/*****************************************************************
+** Function: testReschedule
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testReschedule()
+**
+** Returns:
+**			void
+**
+** Notes:
+** A timer pushed back from its own callback goes off at its new
+** deadline instead, and moving a scheduled timer replaces its old
+** place on the wheel.
+**********************************************************************/
+static void testReschedule()
+{
+    TimerWheel wheel;
+    TestTimer moved;
+    TestTimer again;
+
+    testWheel = &wheel;
+    wheel.start(0);
+
+    moved.node.next = moved.node.prev = NULL;
+    moved.node.owner = &moved;
+    moved.fired = 0;
+    again.node.next = again.node.prev = NULL;
+    again.node.owner = &again;
+    again.fired = 0;
+
+    //moved from 1s out to 20s out
+    moved.deadline = 20000;
+    wheel.schedule(&moved.node, 1000);
+    wheel.schedule(&moved.node, moved.deadline);
+
+    //set for 0.5s, then active at 0.3s with a new deadline of 9s
+    again.deadline = 500;
+    wheel.schedule(&again.node, again.deadline);
+
+    for (testNow = 100; testNow <= 30000; testNow += 100)
+    {
+        if (testNow == 300)
+        {
+            again.deadline = 9000;
+        }
+        wheel.advance(testNow, expireOrPushBack);
+    }
+
+    CHECK(moved.fired == 1);
+    CHECK(moved.firedAt == 20000);
+    CHECK(again.fired == 1);
+    CHECK(again.firedAt == 9000);
+}
+
+
+/*****************************************************************
+** Function: testNextTimeout
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void testNextTimeout()
+**
+** Returns:
+**			void
+**
+** Notes:
+** The wait before the next advance never runs past the first
+** deadline, and is -1 with nothing scheduled.
+**********************************************************************/
+static void testNextTimeout()
+{
+    TimerWheel wheel;
+    TestTimer near;
+    TestTimer far;
+
+    wheel.start(1000);
+    CHECK(wheel.nextTimeout(1000) == -1);
+
+    near.node.next = near.node.prev = NULL;
+    near.node.owner = &near;
+    far.node.next = far.node.prev = NULL;
+    far.node.owner = &far;
+
+    wheel.schedule(&far.node, 1000000);
+    int timeout = wheel.nextTimeout(1000);
+    CHECK(timeout > 0);
+    CHECK(timeout <= 1000000 - 1000);
+
+    wheel.schedule(&near.node, 1250);
+    CHECK(wheel.nextTimeout(1000) == 300);
+    CHECK(wheel.nextTimeout(1290) == 10);
+}
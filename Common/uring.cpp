@@ -0,0 +1,536 @@
+/**********************************************************************
+**	SOURCE FILE:	uring.cpp - Minimal io_uring wrapper class
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+**      URing();
+**      ~URing();
+**      bool setup(unsigned int, unsigned int);
+**      struct io_uring_sqe * getSqe();
+**      int submit(unsigned int);
+**      struct io_uring_cqe * peekCompletion();
+**      void completionSeen();
+**      bool registerBuffers(unsigned short, unsigned int, unsigned int);
+**      char * getBuffer(unsigned short);
+**      void returnBuffer(unsigned short);
+**      void commitBuffers();
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Talks to io_uring through the raw system calls so the server has no
+** library dependencies. Maps the submission and completion rings,
+** hands out submission entries and registers a provided buffer ring
+** that multishot receives pick their buffers from.
+*************************************************************************/
+#include <iostream>
+#include <cstring>
+#include <stdio.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "uring.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: URing
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			URing()
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Base constructor for an unopened ring.
+*********************************************************************/
+URing::URing()
+{
+    ringDescriptor = -1;
+    sqRing = cqRing = NULL;
+    sqRingSize = cqRingSize = 0;
+    sqes = NULL;
+    sqEntries = 0;
+    sqeTail = 0;
+    sqeSubmitted = 0;
+    bufferRing = NULL;
+    bufferBase = NULL;
+    bufferEntries = 0;
+    bufferSize = 0;
+    bufferTail = 0;
+}
+
+
+/*****************************************************************
+** Function: ~URing
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			~URing()
+**
+** Returns:
+**			N/A
+**
+** Notes:
+** Unmaps the rings, the submission entries and the provided buffers,
+** then closes the ring.
+*********************************************************************/
+URing::~URing()
+{
+    if (bufferBase != NULL)
+    {
+        munmap(bufferBase, (size_t) bufferEntries * bufferSize);
+    }
+    if (bufferRing != NULL)
+    {
+        munmap(bufferRing, bufferEntries * sizeof(struct io_uring_buf));
+    }
+    if (sqes != NULL)
+    {
+        munmap(sqes, sqEntries * sizeof(struct io_uring_sqe));
+    }
+    if (cqRing != NULL && cqRing != sqRing)
+    {
+        munmap(cqRing, cqRingSize);
+    }
+    if (sqRing != NULL)
+    {
+        munmap(sqRing, sqRingSize);
+    }
+    if (ringDescriptor != -1)
+    {
+        close(ringDescriptor);
+    }
+}
+
+
+/*****************************************************************
+** Function: setup
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			bool setup(unsigned int entries, unsigned int completions)
+**          unsigned int entries -- size of the submission queue
+**          unsigned int completions -- size of the completion queue
+**
+** Returns:
+**			bool -- true if the ring was created and mapped
+**               -- false if there is issues
+**
+** Notes:
+** Creates the ring and maps its queues into the process.
+*********************************************************************/
+bool URing::setup(unsigned int entries, unsigned int completions)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = completions;
+
+    if ((ringDescriptor = syscall(__NR_io_uring_setup, entries, &params)) == -1)
+    {
+        perror("io_uring_setup");
+        return false;
+    }
+
+    size_t sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    size_t cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    //newer kernels map both rings in one region
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        sqSize = cqSize = (sqSize > cqSize) ? sqSize : cqSize;
+    }
+
+    char *ring = (char *) mmap(0, sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                               ringDescriptor, IORING_OFF_SQ_RING);
+    if (ring == MAP_FAILED)
+    {
+        perror("mmap submission ring");
+        return false;
+    }
+    sqRing = cqRing = ring;
+    sqRingSize = cqRingSize = sqSize;
+
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP))
+    {
+        ring = (char *) mmap(0, cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                             ringDescriptor, IORING_OFF_CQ_RING);
+        if (ring == MAP_FAILED)
+        {
+            cqRing = NULL;
+            perror("mmap completion ring");
+            return false;
+        }
+        cqRing = ring;
+        cqRingSize = cqSize;
+    }
+
+    void *sqeArea = mmap(0, params.sq_entries * sizeof(struct io_uring_sqe),
+                         PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         ringDescriptor, IORING_OFF_SQES);
+    if (sqeArea == MAP_FAILED)
+    {
+        perror("mmap submission entries");
+        return false;
+    }
+    sqes = (struct io_uring_sqe *) sqeArea;
+    sqEntries = params.sq_entries;
+
+    sqHead = (unsigned int *) (sqRing + params.sq_off.head);
+    sqTail = (unsigned int *) (sqRing + params.sq_off.tail);
+    sqMask = *(unsigned int *) (sqRing + params.sq_off.ring_mask);
+
+    //entries are always used in order so the index array is fixed
+    unsigned int *sqArray = (unsigned int *) (sqRing + params.sq_off.array);
+    for (unsigned int i = 0; i < sqEntries; i++)
+    {
+        sqArray[i] = i;
+    }
+
+    cqHead = (unsigned int *) (cqRing + params.cq_off.head);
+    cqTail = (unsigned int *) (cqRing + params.cq_off.tail);
+    cqMask = *(unsigned int *) (cqRing + params.cq_off.ring_mask);
+    cqes = (struct io_uring_cqe *) (cqRing + params.cq_off.cqes);
+
+    sqeTail = sqeSubmitted = *sqTail;
+    return true;
+}
+
+
+/*****************************************************************
+** Function: getSqe
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			struct io_uring_sqe * getSqe()
+**
+** Returns:
+**			struct io_uring_sqe * -- a cleared submission entry
+**                                -- NULL if the queue is full
+**
+** Notes:
+** Hands out the next submission entry. Nothing reaches the kernel
+** until submit is called.
+*********************************************************************/
+struct io_uring_sqe * URing::getSqe()
+{
+    //kernel has not consumed enough entries yet
+    if (sqeTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries)
+    {
+        return NULL;
+    }
+
+    struct io_uring_sqe *sqe = &sqes[sqeTail & sqMask];
+    memset(sqe, 0, sizeof(*sqe));
+    sqeTail++;
+
+    return sqe;
+}
+
+
+/*****************************************************************
+** Function: submit
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			int submit(unsigned int waitFor)
+**          unsigned int waitFor -- completions to block for
+**
+** Returns:
+**			int -- number of entries submitted
+**              -- -1 on a failure
+**
+** Notes:
+** Publishes every entry handed out since the last call and waits
+** for completions in the same system call.
+*********************************************************************/
+int URing::submit(unsigned int waitFor)
+{
+    unsigned int toSubmit = sqeTail - sqeSubmitted;
+
+    __atomic_store_n(sqTail, sqeTail, __ATOMIC_RELEASE);
+    sqeSubmitted = sqeTail;
+
+    int submitted = syscall(__NR_io_uring_enter, ringDescriptor, toSubmit, waitFor,
+                            waitFor > 0 ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+
+    if (submitted == -1 && errno != EINTR)
+    {
+        perror("io_uring_enter");
+    }
+
+    return submitted;
+}
+
+
+/*****************************************************************
+** Function: peekCompletion
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			struct io_uring_cqe * peekCompletion()
+**
+** Returns:
+**			struct io_uring_cqe * -- the oldest unseen completion
+**                                -- NULL if there is none
+**
+** Notes:
+** Looks at the next completion without consuming it.
+*********************************************************************/
+struct io_uring_cqe * URing::peekCompletion()
+{
+    unsigned int head = *cqHead;
+
+    if (head == __atomic_load_n(cqTail, __ATOMIC_ACQUIRE))
+    {
+        return NULL;
+    }
+
+    return &cqes[head & cqMask];
+}
+
+
+/*****************************************************************
+** Function: completionSeen
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void completionSeen()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Gives the oldest completion slot back to the kernel.
+*********************************************************************/
+void URing::completionSeen()
+{
+    __atomic_store_n(cqHead, *cqHead + 1, __ATOMIC_RELEASE);
+}
+
+
+/*****************************************************************
+** Function: registerBuffers
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			bool registerBuffers(unsigned short group, unsigned int entries,
+**                               unsigned int size)
+**          unsigned short group -- buffer group id used by receives
+**          unsigned int entries -- number of buffers (power of 2)
+**          unsigned int size -- size of each buffer
+**
+** Returns:
+**			bool -- true if the buffer ring was registered
+**               -- false if there is issues
+**
+** Notes:
+** Registers a provided buffer ring and fills it with every buffer.
+*********************************************************************/
+bool URing::registerBuffers(unsigned short group, unsigned int entries, unsigned int size)
+{
+    bufferEntries = entries;
+    bufferSize = size;
+
+    void *ring = mmap(0, entries * sizeof(struct io_uring_buf), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    void *base = mmap(0, (size_t) entries * size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    //keep whichever mapping worked so the destructor releases it
+    bufferRing = (ring == MAP_FAILED) ? NULL : (struct io_uring_buf_ring *) ring;
+    bufferBase = (base == MAP_FAILED) ? NULL : (char *) base;
+
+    if (bufferRing == NULL || bufferBase == NULL)
+    {
+        perror("mmap buffer ring");
+        return false;
+    }
+
+    struct io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (unsigned long) bufferRing;
+    reg.ring_entries = entries;
+    reg.bgid = group;
+
+    if (syscall(__NR_io_uring_register, ringDescriptor, IORING_REGISTER_PBUF_RING, &reg, 1) == -1)
+    {
+        perror("io_uring_register buffer ring");
+        return false;
+    }
+
+    for (unsigned int i = 0; i < entries; i++)
+    {
+        returnBuffer(i);
+    }
+    commitBuffers();
+
+    return true;
+}
+
+
+/*****************************************************************
+** Function: getBuffer
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			char * getBuffer(unsigned short bufferId)
+**          unsigned short bufferId -- id from a receive completion
+**
+** Returns:
+**			char * -- start of the buffer
+**
+** Notes:
+** Maps a buffer id back to its memory.
+*********************************************************************/
+char * URing::getBuffer(unsigned short bufferId)
+{
+    return bufferBase + (size_t) bufferId * bufferSize;
+}
+
+
+/*****************************************************************
+** Function: returnBuffer
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void returnBuffer(unsigned short bufferId)
+**          unsigned short bufferId -- buffer that is free again
+**
+** Returns:
+**			void
+**
+** Notes:
+** Puts a buffer back on the ring. The kernel only sees it after
+** commitBuffers is called.
+*********************************************************************/
+void URing::returnBuffer(unsigned short bufferId)
+{
+    //index by hand; in C++ the header's flex array sits behind a
+    //one byte empty struct and bufs[] would be misplaced
+    struct io_uring_buf *buf = (struct io_uring_buf *) bufferRing + (bufferTail & (bufferEntries - 1));
+
+    buf->addr = (unsigned long) getBuffer(bufferId);
+    buf->len = bufferSize;
+    buf->bid = bufferId;
+    bufferTail++;
+}
+
+
+/*****************************************************************
+** Function: commitBuffers
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**			void commitBuffers()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Publishes every buffer returned since the last commit.
+*********************************************************************/
+void URing::commitBuffers()
+{
+    __atomic_store_n(&bufferRing->tail, bufferTail, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,66 @@
+#ifndef URING_H
+#define URING_H
+
+#include <cstddef>
+#include <linux/io_uring.h>
+
+class URing
+{
+    public:
+        /** Initializers **/
+        URing();
+        ~URing();
+        bool setup(unsigned int, unsigned int);
+
+        //the mappings and descriptor belong to one ring only
+        URing(const URing &) = delete;
+        URing & operator=(const URing &) = delete;
+
+        /** Submission queue **/
+        struct io_uring_sqe * getSqe();
+        int submit(unsigned int);
+
+        /** Completion queue **/
+        struct io_uring_cqe * peekCompletion();
+        void completionSeen();
+
+        /** Provided buffer ring **/
+        bool registerBuffers(unsigned short, unsigned int, unsigned int);
+        char * getBuffer(unsigned short);
+        void returnBuffer(unsigned short);
+        void commitBuffers();
+
+    private:
+        int ringDescriptor;
+
+        //mapped ring regions; the completion ring shares the
+        //submission ring's region on kernels with a single mmap
+        char *sqRing;
+        size_t sqRingSize;
+        char *cqRing;
+        size_t cqRingSize;
+
+        //submission ring
+        unsigned int *sqHead;
+        unsigned int *sqTail;
+        unsigned int sqMask;
+        unsigned int sqEntries;
+        unsigned int sqeTail;
+        unsigned int sqeSubmitted;
+        struct io_uring_sqe *sqes;
+
+        //completion ring
+        unsigned int *cqHead;
+        unsigned int *cqTail;
+        unsigned int cqMask;
+        struct io_uring_cqe *cqes;
+
+        //provided buffers
+        struct io_uring_buf_ring *bufferRing;
+        unsigned int bufferEntries;
+        unsigned int bufferSize;
+        unsigned short bufferTail;
+        char *bufferBase;
+};
+
+#endif //URING_H
@@ -0,0 +1,881 @@
+/**********************************************************************
+**	SOURCE FILE:	uring_server.cpp - io_uring engine for the server
+**
+**	PROGRAM:	Scalable Server
+**
+**	FUNCTIONS:
+** int uringState(int, int, int, unsigned long long)
+** static unsigned long long packUserData(int, UringClient &)
+** static struct io_uring_sqe * nextSqe(URing &)
+** static void armAccept(URing &, int)
+** static void armReceive(URing &, UringClient &)
+** static void pumpSends(URing &, UringClient &)
+** static void closeUringClient(URing &, UringClient &)
+** static void finishUringClose(URing &, UringClient &)
+** static void armTimeout(URing &, int)
+** static void noteExpired(void *)
+** static void expireUringClients(URing &, unsigned long long, unsigned long long)
+** static int drainUringClients(URing &, bool, int)
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Completion based engine for the echo server, run by a worker in
+** place of its readiness loop. Accepts come from one multishot
+** accept, every client has one multishot receive that takes buffers
+** from a provided buffer ring, and echoes are sent straight out of the
+** receive buffer. Queued echoes for a client are
+** submitted as one chain of linked sends so they leave in order, and
+** a buffer goes back to the ring once its send completes. Everything
+** queued during a pass is submitted with a single io_uring_enter that
+** also waits for the next batch of completions.
+**
+** A client that sends nothing for the idle timeout is closed. Its
+** deadline sits on the worker's timer wheel, and whenever one is due
+** the wait carries a timeout request for it, so the worker wakes to
+** close the client even when nothing else completes.
+**
+** When the server drains, the multishot accept is cancelled and each
+** client is closed once it has no echoes left to send.
+*************************************************************************/
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <stdio.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "uring.h"
+#include "timer_wheel.h"
+#include "uring_server.h"
+
+using namespace std;
+
+//operation kinds packed into the top byte of user_data
+#define URING_OP_ACCEPT 1
+#define URING_OP_RECV 2
+#define URING_OP_SEND 3
+#define URING_OP_CANCEL 4
+#define URING_OP_TIMEOUT 5
+
+/** A received buffer waiting to be echoed back **/
+struct UringSend
+{
+    unsigned short bufferId;
+    unsigned int length;
+};
+
+/** io_uring engine state for one client **/
+struct UringClient
+{
+    int sock;
+    unsigned int generation;
+    bool receiveArmed;
+    bool starved;
+    bool closing;
+
+    //last accept or receive, for draining and the idle timeout
+    unsigned long long lastActive;
+    TimerNode timer;
+
+    //front sendsInFlight entries are submitted, the rest are queued
+    deque<UringSend> sends;
+    int sendsInFlight;
+
+    UringClient() : sock(-1), generation(0), receiveArmed(false), starved(false),
+                    closing(false), lastActive(0), sendsInFlight(0)
+    {
+        timer.next = timer.prev = NULL;
+        timer.expiryTick = 0;
+        timer.owner = this;
+    }
+};
+
+//per-client state indexed by socket descriptor; a deque so growing it
+//leaves the timers already on the wheel where they are
+thread_local deque<UringClient> uringClients;
+
+//idle deadlines, and the clients found past theirs in one advance
+static thread_local TimerWheel uringTimers;
+static thread_local vector<UringClient *> expiredClients;
+
+//the wait's timeout; the kernel reads it when the request is submitted
+static thread_local struct __kernel_timespec waitTimeout;
+
+//clients whose receive stopped because the buffer ring ran dry
+thread_local vector<int> starvedClients;
+
+static void armAccept(URing &, int);
+static void armReceive(URing &, UringClient &);
+static void pumpSends(URing &, UringClient &);
+static void closeUringClient(URing &, UringClient &);
+static void finishUringClose(URing &, UringClient &);
+static void armTimeout(URing &, int);
+static void noteExpired(void *);
+static void expireUringClients(URing &, unsigned long long, unsigned long long);
+static int drainUringClients(URing &, bool, int);
+
+/*****************************************************************
+** Function: packUserData
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static unsigned long long packUserData(int op, UringClient &client)
+**              int op -- URING_OP_* kind of request
+**              UringClient &client -- client the request belongs to
+**
+** Returns:
+**			unsigned long long -- user_data for the submission
+**
+** Notes:
+** Tags a request with its kind, the client socket and the client's
+** generation so completions for a reused descriptor can be told apart.
+**********************************************************************/
+static unsigned long long packUserData(int op, UringClient &client)
+{
+    return ((unsigned long long) op << 56) |
+           ((unsigned long long) (client.generation & 0xffffff) << 32) |
+           (unsigned int) client.sock;
+}
+
+/*****************************************************************
+** Function: nextSqe
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static struct io_uring_sqe * nextSqe(URing &ring)
+**              URing &ring -- worker's ring
+**
+** Returns:
+**			struct io_uring_sqe * -- a free submission entry
+**
+** Notes:
+** Gets a submission entry, flushing the queue to the kernel first
+** if it is full.
+**********************************************************************/
+static struct io_uring_sqe * nextSqe(URing &ring)
+{
+    struct io_uring_sqe *sqe;
+
+    while ((sqe = ring.getSqe()) == NULL)
+    {
+        ring.submit(0);
+    }
+
+    return sqe;
+}
+
+/*****************************************************************
+** Function: uringState
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int uringState(int listener, int bufferSize, int quietMillis,
+**                         unsigned long long idleMillis)
+**              int listener -- this worker's listening socket
+**              int bufferSize -- size of each provided receive buffer
+**              int quietMillis -- silence after which a draining
+**                                 client is closed
+**              unsigned long long idleMillis -- silence after which any
+**                                 client is closed (0 for never)
+**
+** Returns:
+**			int -- -1 if the ring could not be set up
+**
+** Notes:
+** Handles new connections, closed connections, and data received
+** from clients using io_uring. Returns 0 once the worker has drained.
+**********************************************************************/
+int uringState(int listener, int bufferSize, int quietMillis, unsigned long long idleMillis)
+{
+    URing ring;
+
+    if (!ring.setup(URING_ENTRIES, URING_ENTRIES * 4))
+    {
+        cerr << "Failed to create io_uring" << endl;
+        return -1;
+    }
+
+    if (!ring.registerBuffers(URING_BUFFER_GROUP, URING_BUFFER_COUNT, bufferSize))
+    {
+        cerr << "Failed to register io_uring buffers" << endl;
+        return -1;
+    }
+
+    armAccept(ring, listener);
+
+    bool drainStarted = false;
+    bool accepting = true;
+    bool timeoutArmed = false;
+    unsigned long long drainDeadline = 0;
+    unsigned long long now = monotonicMillis();
+
+    uringTimers.start(now);
+
+    while (true)
+    {
+        //close clients whose deadlines have passed
+        now = monotonicMillis();
+        expireUringClients(ring, now, idleMillis);
+
+        //stop accepting; clients are closed as they go idle
+        if (drainRequested() && !drainStarted)
+        {
+            struct io_uring_sqe *sqe = nextSqe(ring);
+
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = (unsigned long long) URING_OP_ACCEPT << 56;
+            sqe->user_data = (unsigned long long) URING_OP_CANCEL << 56;
+
+            drainStarted = true;
+            drainDeadline = beginDrain(listener);
+        }
+
+        //clients the cancelled accept took in are still to come until
+        //its final completion
+        if (drainStarted && drainUringClients(ring, monotonicMillis() >= drainDeadline, quietMillis) == 0 && !accepting)
+        {
+            return 0;
+        }
+
+        //wake up for the next deadline, or to close draining clients
+        //as they go quiet
+        int timeout = uringTimers.nextTimeout(now);
+        if (drainStarted)
+        {
+            int remaining = drainDeadline > now ? drainDeadline - now : 0;
+            if (remaining > quietMillis)
+            {
+                remaining = quietMillis;
+            }
+            if (timeout < 0 || timeout > remaining)
+            {
+                timeout = remaining;
+            }
+        }
+
+        if (timeout >= 0 && !timeoutArmed)
+        {
+            armTimeout(ring, timeout);
+            timeoutArmed = true;
+        }
+
+        //submit everything queued last pass and wait for more work
+        if (ring.submit(1) == -1 && errno != EINTR && errno != EBUSY)
+        {
+            return -1;
+        }
+
+        struct io_uring_cqe *cqe;
+        bool buffersReturned = false;
+
+        while ((cqe = ring.peekCompletion()) != NULL)
+        {
+            int op = cqe->user_data >> 56;
+            unsigned int generation = (cqe->user_data >> 32) & 0xffffff;
+            int socket = (int) (cqe->user_data & 0xffffffff);
+            int result = cqe->res;
+            unsigned int flags = cqe->flags;
+
+            ring.completionSeen();
+
+            //New connection is being made to the listening socket
+            if (op == URING_OP_ACCEPT)
+            {
+                if (result >= 0)
+                {
+                    if (result >= (int) uringClients.size())
+                    {
+                        uringClients.resize(result + 1);
+                    }
+
+                    UringClient &client = uringClients[result];
+                    client.sock = result;
+                    client.receiveArmed = false;
+                    client.starved = false;
+                    client.closing = false;
+                    client.sends.clear();
+                    client.sendsInFlight = 0;
+                    client.lastActive = monotonicMillis();
+
+                    //start the client's idle clock
+                    if (idleMillis > 0)
+                    {
+                        uringTimers.schedule(&client.timer, client.lastActive + idleMillis);
+                    }
+
+                    reportConnected();
+                    armReceive(ring, client);
+                }
+                else if (result != -EAGAIN && result != -EINTR && result != -ECONNABORTED && result != -ECANCELED)
+                {
+                    errno = -result;
+                    perror("accept");
+                }
+
+                //multishot accept was terminated; start another
+                if (!(flags & IORING_CQE_F_MORE))
+                {
+                    if (drainStarted)
+                    {
+                        accepting = false;
+                    }
+                    else
+                    {
+                        armAccept(ring, listener);
+                    }
+                }
+                continue;
+            }
+
+            if (op == URING_OP_CANCEL)
+            {
+                continue;
+            }
+
+            //fired, or cut short by another completion
+            if (op == URING_OP_TIMEOUT)
+            {
+                timeoutArmed = false;
+                continue;
+            }
+
+            UringClient &client = uringClients[socket];
+
+            //completion for a client that has since gone away
+            if (generation != (client.generation & 0xffffff) || client.sock != socket)
+            {
+                if (flags & IORING_CQE_F_BUFFER)
+                {
+                    ring.returnBuffer(flags >> IORING_CQE_BUFFER_SHIFT);
+                    buffersReturned = true;
+                }
+                continue;
+            }
+
+            if (op == URING_OP_RECV)
+            {
+                if (!(flags & IORING_CQE_F_MORE))
+                {
+                    client.receiveArmed = false;
+                }
+
+                //there must be data
+                if (result > 0)
+                {
+                    UringSend send;
+                    send.bufferId = flags >> IORING_CQE_BUFFER_SHIFT;
+                    send.length = result;
+                    client.lastActive = monotonicMillis();
+
+                    if (client.closing)
+                    {
+                        ring.returnBuffer(send.bufferId);
+                        buffersReturned = true;
+                    }
+                    else
+                    {
+                        client.sends.push_back(send);
+                        pumpSends(ring, client);
+
+                        //multishot ended early (e.g. a full CQ); rearm it
+                        if (!client.receiveArmed)
+                        {
+                            armReceive(ring, client);
+                        }
+                    }
+                }
+                //out of buffers; receive again once sends hand some back
+                else if (result == -ENOBUFS && !client.closing)
+                {
+                    if (!client.receiveArmed && !client.starved)
+                    {
+                        client.starved = true;
+                        starvedClients.push_back(socket);
+                    }
+                }
+                //closed by the client or failed
+                else
+                {
+                    closeUringClient(ring, client);
+                }
+            }
+            else if (op == URING_OP_SEND)
+            {
+                UringSend send = client.sends.front();
+                client.sends.pop_front();
+                client.sendsInFlight--;
+
+                ring.returnBuffer(send.bufferId);
+                buffersReturned = true;
+
+                //MSG_WAITALL sends are only short on errors
+                if (result != (int) send.length)
+                {
+                    closeUringClient(ring, client);
+                }
+                else
+                {
+                    reportEchoed(send.length);
+                    pumpSends(ring, client);
+                }
+            }
+
+            if (client.closing)
+            {
+                finishUringClose(ring, client);
+            }
+        }
+
+        if (buffersReturned)
+        {
+            ring.commitBuffers();
+
+            //give receives that ran dry another go
+            for (int i = 0; i < (int) starvedClients.size(); i++)
+            {
+                UringClient &client = uringClients[starvedClients[i]];
+                client.starved = false;
+
+                if (client.sock == starvedClients[i] && !client.closing && !client.receiveArmed)
+                {
+                    armReceive(ring, client);
+                }
+            }
+            starvedClients.clear();
+        }
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: armAccept
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void armAccept(URing &ring, int listener)
+**              URing &ring -- worker's ring
+**              int listener -- listening socket
+**
+** Returns:
+**			void
+**
+** Notes:
+** Queues a multishot accept that completes once per new client.
+**********************************************************************/
+static void armAccept(URing &ring, int listener)
+{
+    struct io_uring_sqe *sqe = nextSqe(ring);
+
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = listener;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_CLOEXEC;
+    sqe->user_data = (unsigned long long) URING_OP_ACCEPT << 56;
+}
+
+/*****************************************************************
+** Function: armReceive
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void armReceive(URing &ring, UringClient &client)
+**              URing &ring -- worker's ring
+**              UringClient &client -- client to receive from
+**
+** Returns:
+**			void
+**
+** Notes:
+** Queues a multishot receive that picks a buffer from the provided
+** buffer ring for every chunk of data the client sends.
+**********************************************************************/
+static void armReceive(URing &ring, UringClient &client)
+{
+    struct io_uring_sqe *sqe = nextSqe(ring);
+
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = client.sock;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = URING_BUFFER_GROUP;
+    sqe->user_data = packUserData(URING_OP_RECV, client);
+
+    client.receiveArmed = true;
+}
+
+/*****************************************************************
+** Function: pumpSends
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void pumpSends(URing &ring, UringClient &client)
+**              URing &ring -- worker's ring
+**              UringClient &client -- client with queued echoes
+**
+** Returns:
+**			void
+**
+** Notes:
+** Once the previous chain has finished, submits up to
+** URING_SEND_CHAIN queued echoes as linked sends so the kernel
+** sends them back to back and in order.
+**********************************************************************/
+static void pumpSends(URing &ring, UringClient &client)
+{
+    if (client.sendsInFlight > 0 || client.closing)
+    {
+        return;
+    }
+
+    int chain = client.sends.size();
+    if (chain > URING_SEND_CHAIN)
+    {
+        chain = URING_SEND_CHAIN;
+    }
+
+    for (int i = 0; i < chain; i++)
+    {
+        struct io_uring_sqe *sqe = nextSqe(ring);
+
+        sqe->opcode = IORING_OP_SEND;
+        sqe->fd = client.sock;
+        sqe->addr = (unsigned long) ring.getBuffer(client.sends[i].bufferId);
+        sqe->len = client.sends[i].length;
+        sqe->msg_flags = MSG_WAITALL | MSG_NOSIGNAL;
+        sqe->user_data = packUserData(URING_OP_SEND, client);
+
+        //link to the next send in the chain
+        if (i < chain - 1)
+        {
+            sqe->flags = IOSQE_IO_LINK;
+        }
+    }
+
+    client.sendsInFlight = chain;
+}
+
+/*****************************************************************
+** Function: closeUringClient
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void closeUringClient(URing &ring, UringClient &client)
+**              URing &ring -- worker's ring
+**              UringClient &client -- client to close
+**
+** Returns:
+**			void
+**
+** Notes:
+** Starts closing a client by cancelling its receive. The socket is
+** only closed by finishUringClose once nothing is left in flight.
+**********************************************************************/
+static void closeUringClient(URing &ring, UringClient &client)
+{
+    if (client.closing)
+    {
+        return;
+    }
+    client.closing = true;
+    uringTimers.cancel(&client.timer);
+
+    if (client.receiveArmed)
+    {
+        struct io_uring_sqe *sqe = nextSqe(ring);
+
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = packUserData(URING_OP_RECV, client);
+        sqe->user_data = (unsigned long long) URING_OP_CANCEL << 56;
+    }
+}
+
+/*****************************************************************
+** Function: finishUringClose
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void finishUringClose(URing &ring, UringClient &client)
+**              URing &ring -- worker's ring
+**              UringClient &client -- client being closed
+**
+** Returns:
+**			void
+**
+** Notes:
+** Closes the socket once the receive and all sends have completed,
+** returning the buffers of echoes that will never be sent.
+**********************************************************************/
+static void finishUringClose(URing &ring, UringClient &client)
+{
+    if (client.receiveArmed || client.sendsInFlight > 0)
+    {
+        return;
+    }
+
+    for (int i = 0; i < (int) client.sends.size(); i++)
+    {
+        ring.returnBuffer(client.sends[i].bufferId);
+    }
+    client.sends.clear();
+    ring.commitBuffers();
+
+    close(client.sock);
+    client.sock = -1;
+    client.generation++;
+
+    reportDone();
+}
+
+/*****************************************************************
+** Function: armTimeout
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void armTimeout(URing &ring, int millis)
+**              URing &ring -- worker's ring
+**              int millis -- longest the next wait may block
+**
+** Returns:
+**			void
+**
+** Notes:
+** Queues a timeout that completes after millis, or as soon as any
+** other request completes, so the wait it is submitted with never
+** blocks past the next deadline.
+**********************************************************************/
+static void armTimeout(URing &ring, int millis)
+{
+    struct io_uring_sqe *sqe = nextSqe(ring);
+
+    waitTimeout.tv_sec = millis / 1000;
+    waitTimeout.tv_nsec = (millis % 1000) * 1000000LL;
+
+    sqe->opcode = IORING_OP_TIMEOUT;
+    sqe->fd = -1;
+    sqe->addr = (unsigned long) &waitTimeout;
+    sqe->len = 1;
+    sqe->off = 1;
+    sqe->user_data = (unsigned long long) URING_OP_TIMEOUT << 56;
+}
+
+/*****************************************************************
+** Function: noteExpired
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void noteExpired(void *owner)
+**              void *owner -- UringClient whose deadline passed
+**
+** Returns:
+**			void
+**
+** Notes:
+** Called by the timer wheel. Closing a client needs the ring, so the
+** client is only collected here for expireUringClients.
+**********************************************************************/
+static void noteExpired(void *owner)
+{
+    expiredClients.push_back((UringClient *) owner);
+}
+
+/*****************************************************************
+** Function: expireUringClients
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static void expireUringClients(URing &ring, unsigned long long now,
+**                                         unsigned long long idleMillis)
+**              URing &ring -- worker's ring
+**              unsigned long long now -- current monotonic time
+**              unsigned long long idleMillis -- idle timeout
+**
+** Returns:
+**			void
+**
+** Notes:
+** Advances the timer wheel. Receives only stamp the client, so one
+** that was active since its timer was set is pushed back to its new
+** deadline here; the rest are closed.
+**********************************************************************/
+static void expireUringClients(URing &ring, unsigned long long now, unsigned long long idleMillis)
+{
+    uringTimers.advance(now, noteExpired);
+
+    for (int i = 0; i < (int) expiredClients.size(); i++)
+    {
+        UringClient &client = *expiredClients[i];
+        unsigned long long deadline = client.lastActive + idleMillis;
+
+        if (deadline > now)
+        {
+            uringTimers.schedule(&client.timer, deadline);
+            continue;
+        }
+
+        closeUringClient(ring, client);
+        finishUringClose(ring, client);
+    }
+    expiredClients.clear();
+}
+
+/*****************************************************************
+** Function: drainUringClients
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static int drainUringClients(URing &ring, bool expired, int quietMillis)
+**              URing &ring -- worker's ring
+**              bool expired -- true once the drain deadline has passed
+**              int quietMillis -- silence after which a client is closed
+**
+** Returns:
+**			int -- number of clients still open
+**
+** Notes:
+** Starts closing every client with no echoes waiting that has been
+** quiet for quietMillis. Past the deadline the sockets are closed
+** outright instead, since the ring goes away with the worker.
+**********************************************************************/
+static int drainUringClients(URing &ring, bool expired, int quietMillis)
+{
+    unsigned long long now = monotonicMillis();
+    int open = 0;
+
+    for (int i = 0; i < (int) uringClients.size(); i++)
+    {
+        UringClient &client = uringClients[i];
+        if (client.sock < 0)
+        {
+            continue;
+        }
+
+        if (expired)
+        {
+            uringTimers.cancel(&client.timer);
+            close(client.sock);
+            client.sock = -1;
+            client.generation++;
+            reportDone();
+            continue;
+        }
+
+        if (client.sends.empty() && now - client.lastActive >= (unsigned long long) quietMillis)
+        {
+            closeUringClient(ring, client);
+            finishUringClose(ring, client);
+        }
+
+        if (client.sock >= 0)
+        {
+            open++;
+        }
+    }
+
+    return open;
+}
@@ -0,0 +1,21 @@
+#ifndef URING_SERVER_H
+#define URING_SERVER_H
+
+//io_uring engine sizes (buffer count must be a power of 2)
+#define URING_ENTRIES 4096
+#define URING_BUFFER_GROUP 0
+#define URING_BUFFER_COUNT 1024
+#define URING_BUFFER_SIZE 4096
+#define URING_SEND_CHAIN 16
+
+/** Engine loop **/
+int uringState(int, int, int, unsigned long long);
+
+/** Supplied by the server running the engine **/
+void reportConnected();
+void reportDone();
+void reportEchoed(unsigned long long);
+bool drainRequested();
+unsigned long long beginDrain(int);
+
+#endif //URING_SERVER_H
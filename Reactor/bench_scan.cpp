@@ -0,0 +1,306 @@
+/**********************************************************************
+**	SOURCE FILE:	bench_scan.cpp - Times the ways of finding ready clients
+**
+**	PROGRAM:	Scalable Server -- Reactor based
+**
+**	FUNCTIONS:
+**      static unsigned long long nanoTime();
+**      static long long walkClients(const fd_set *, int);
+**      static long long scanWords(const fd_set *, int);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** Microbenchmark for the search that follows every select. It fills
+** the client table the way a worker would, then for a range of ready
+** counts times the two ways of finding the ready clients in the set
+** select returns:
+**
+**   walk -- every client slot up to the highest one used is tested with
+**           FD_ISSET, stopping once the ready count is reached, as the
+**           old Select server did before ready_scan.cpp
+**   scan -- ReadyScan reads the set a word at a time and each ready
+**           descriptor is mapped to its slot through a table
+**
+** Each round uses one of a number of ready sets drawn at random ahead
+** of time, so the branch predictor cannot learn a single pattern. Both
+** searches add up the slots they find; the sums must agree.
+**
+** Build with make bench_scan and run as
+**   ./bench_scan [clients] [rounds]
+** (1000 clients and 200000 rounds by default).
+*************************************************************************/
+#include <iostream>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/select.h>
+#include "tcpsocket.h"
+#include "ready_scan.h"
+
+using namespace std;
+
+//descriptors below this are taken by the standard streams and listener
+#define FIRST_CLIENT_DESCRIPTOR 4
+
+//different ready sets cycled through by the rounds
+#define READY_SETS 64
+
+/** The table the server searches **/
+TCPSocket clients[FD_SETSIZE];
+int descriptorSlots[FD_SETSIZE];
+int maxIndex;
+int maxFileDescriptors;
+
+static unsigned long long nanoTime();
+static long long walkClients(const fd_set *, int);
+static long long scanWords(const fd_set *, int);
+
+
+/*****************************************************************
+** Function: main
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		     int main(int argc, char *argv[])
+**              int argc -- number of command line arguments
+**              char *argv[] -- client count and rounds, both optional
+**
+** Returns:
+**			int -- 0 if both searches agreed
+**              -- -1 on bad arguments or a mismatch
+**
+** Notes:
+** Prints the nanoseconds each search takes per wakeup at every ready
+** count.
+**********************************************************************/
+int main(int argc, char *argv[])
+{
+    int clientCount = argc > 1 ? atoi(argv[1]) : 1000;
+    int rounds = argc > 2 ? atoi(argv[2]) : 200000;
+    const int readyCounts[] = {1, 4, 16, 64, 256, 1000};
+
+    if (clientCount <= 0 || clientCount > FD_SETSIZE - FIRST_CLIENT_DESCRIPTOR || rounds <= 0)
+    {
+        cerr << "usage: " << argv[0] << " [clients (1-" << FD_SETSIZE - FIRST_CLIENT_DESCRIPTOR << ")] [rounds]" << endl;
+        return -1;
+    }
+
+    //one client per descriptor, in slot order, as a fresh worker has them
+    for (int i = 0; i < FD_SETSIZE; i++)
+    {
+        clients[i] = -1;
+        descriptorSlots[i] = -1;
+    }
+    for (int i = 0; i < clientCount; i++)
+    {
+        clients[i] = FIRST_CLIENT_DESCRIPTOR + i;
+        descriptorSlots[FIRST_CLIENT_DESCRIPTOR + i] = i;
+    }
+    maxIndex = clientCount - 1;
+    maxFileDescriptors = FIRST_CLIENT_DESCRIPTOR + clientCount - 1;
+
+    srand(1);
+    printf("%d clients, %d rounds\n", clientCount, rounds);
+    printf("%8s %12s %12s %8s\n", "ready", "walk ns", "scan ns", "speedup");
+
+    for (size_t r = 0; r < sizeof(readyCounts) / sizeof(readyCounts[0]); r++)
+    {
+        //every client ready is the last row, however many there are
+        int readyCount = readyCounts[r] < clientCount ? readyCounts[r] : clientCount;
+        if (r > 0 && readyCounts[r - 1] >= clientCount)
+        {
+            break;
+        }
+
+        vector<fd_set> sets(READY_SETS);
+
+        for (int s = 0; s < READY_SETS; s++)
+        {
+            FD_ZERO(&sets[s]);
+            for (int n = 0; n < readyCount; )
+            {
+                int fd = FIRST_CLIENT_DESCRIPTOR + rand() % clientCount;
+                if (!FD_ISSET(fd, &sets[s]))
+                {
+                    FD_SET(fd, &sets[s]);
+                    n++;
+                }
+            }
+        }
+
+        long long walkSum = 0;
+        long long scanSum = 0;
+
+        unsigned long long start = nanoTime();
+        for (int i = 0; i < rounds; i++)
+        {
+            walkSum += walkClients(&sets[i % READY_SETS], readyCount);
+        }
+        unsigned long long walkTime = nanoTime() - start;
+
+        start = nanoTime();
+        for (int i = 0; i < rounds; i++)
+        {
+            scanSum += scanWords(&sets[i % READY_SETS], readyCount);
+        }
+        unsigned long long scanTime = nanoTime() - start;
+
+        if (walkSum != scanSum)
+        {
+            cerr << "The searches disagree at " << readyCount << " ready clients." << endl;
+            return -1;
+        }
+
+        printf("%8d %12.1f %12.1f %7.1fx\n", readyCount, (double) walkTime / rounds,
+            (double) scanTime / rounds, (double) walkTime / (scanTime ? scanTime : 1));
+    }
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: nanoTime
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static unsigned long long nanoTime()
+**
+** Returns:
+**			unsigned long long -- monotonic clock in nanoseconds
+**
+** Notes:
+** Reads the clock the rounds are timed with.
+**********************************************************************/
+static unsigned long long nanoTime()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+/*****************************************************************
+** Function: walkClients
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static long long walkClients(const fd_set *readySet, int numReadySockets)
+**              const fd_set *readySet -- set returned by select
+**              int numReadySockets -- count returned by select
+**
+** Returns:
+**			long long -- sum of the ready slots
+**
+** Notes:
+** Tests every slot with FD_ISSET, as the old Select server did.
+**********************************************************************/
+static long long walkClients(const fd_set *readySet, int numReadySockets)
+{
+    long long sum = 0;
+
+    for (int i = 0; i <= maxIndex; i++)
+    {
+        int socketFileDescriptor = clients[i].getSocketValue();
+
+        if (socketFileDescriptor < 0)
+        {
+            continue;
+        }
+
+        if (FD_ISSET(socketFileDescriptor, readySet))
+        {
+            sum += i;
+
+            if (--numReadySockets <= 0)
+            {
+                break;
+            }
+        }
+    }
+
+    return sum;
+}
+
+
+/*****************************************************************
+** Function: scanWords
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static long long scanWords(const fd_set *readySet, int numReadySockets)
+**              const fd_set *readySet -- set returned by select
+**              int numReadySockets -- count returned by select
+**
+** Returns:
+**			long long -- sum of the ready slots
+**
+** Notes:
+** Finds the ready descriptors with ReadyScan, as SelectReactor does.
+**********************************************************************/
+static long long scanWords(const fd_set *readySet, int numReadySockets)
+{
+    ReadyScan scan(readySet, maxFileDescriptors);
+    long long sum = 0;
+    int socketFileDescriptor;
+
+    while ((socketFileDescriptor = scan.next()) >= 0)
+    {
+        int i = descriptorSlots[socketFileDescriptor];
+
+        if (i < 0)
+        {
+            continue;
+        }
+
+        sum += i;
+
+        if (--numReadySockets <= 0)
+        {
+            break;
+        }
+    }
+
+    return sum;
+}
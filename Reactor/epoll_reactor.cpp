@@ -0,0 +1,336 @@
+/**********************************************************************
+**	SOURCE FILE:	epoll_reactor.cpp - Reactor backend built on epoll
+**
+**	PROGRAM:	Scalable Server -- Reactor based
+**
+**	FUNCTIONS:
+**      EpollReactor(int);
+**      ~EpollReactor();
+**      const char *getName();
+**      bool open();
+**      int registerSocket(int, int);
+**      int modifySocket(int, int);
+**      int deregisterSocket(int);
+**      int wait(int);
+**      int control(int, int, int);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** epoll as a backend (-e epoll), level triggered like the others so
+** the server needs no read-until-EAGAIN rule for this one alone. The
+** event array starts small and grows with busy wakeups up to the
+** limit it was made with (see event_batch.cpp); sockets that did not
+** fit are picked up by the next wait.
+*************************************************************************/
+#include <stdio.h>
+#include <unistd.h>
+#include "reactor.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: EpollReactor
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    EpollReactor(int maxEvents)
+**              int maxEvents -- most events one wait may grow to return
+**
+** Returns:
+**			void
+**
+** Notes:
+** Creates the backend; open makes the epoll instance.
+**********************************************************************/
+EpollReactor::EpollReactor(int maxEvents) : batch(maxEvents)
+{
+    epollDescriptor = -1;
+}
+
+
+/*****************************************************************
+** Function: ~EpollReactor
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    ~EpollReactor()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Closes the epoll instance.
+**********************************************************************/
+EpollReactor::~EpollReactor()
+{
+    if (epollDescriptor >= 0)
+    {
+        close(epollDescriptor);
+    }
+}
+
+
+/*****************************************************************
+** Function: getName
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    const char *getName()
+**
+** Returns:
+**			const char * -- name -e selects the backend by
+**
+** Notes:
+** Names the epoll backend.
+**********************************************************************/
+const char *EpollReactor::getName()
+{
+    return "epoll";
+}
+
+
+/*****************************************************************
+** Function: open
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    bool open()
+**
+** Returns:
+**			bool -- true if the epoll instance was made
+**               -- false if not
+**
+** Notes:
+** Makes the epoll instance.
+**********************************************************************/
+bool EpollReactor::open()
+{
+    if ((epollDescriptor = epoll_create1(EPOLL_CLOEXEC)) == -1)
+    {
+        perror("epoll_create1");
+        return false;
+    }
+
+    return true;
+}
+
+
+/*****************************************************************
+** Function: registerSocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int registerSocket(int sock, int interest)
+**              int sock -- socket to watch
+**              int interest -- REACTOR_* bits to watch it for
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if epoll refused it
+**
+** Notes:
+** Adds the socket to the epoll instance.
+**********************************************************************/
+int EpollReactor::registerSocket(int sock, int interest)
+{
+    return control(EPOLL_CTL_ADD, sock, interest);
+}
+
+
+/*****************************************************************
+** Function: modifySocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int modifySocket(int sock, int interest)
+**              int sock -- registered socket
+**              int interest -- REACTOR_* bits to watch it for now
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if epoll refused it
+**
+** Notes:
+** Changes what the socket is watched for.
+**********************************************************************/
+int EpollReactor::modifySocket(int sock, int interest)
+{
+    return control(EPOLL_CTL_MOD, sock, interest);
+}
+
+
+/*****************************************************************
+** Function: deregisterSocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int deregisterSocket(int sock)
+**              int sock -- registered socket
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if epoll refused it
+**
+** Notes:
+** Removes the socket from the epoll instance.
+**********************************************************************/
+int EpollReactor::deregisterSocket(int sock)
+{
+    return control(EPOLL_CTL_DEL, sock, 0);
+}
+
+
+/*****************************************************************
+** Function: control
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int control(int operation, int sock, int interest)
+**              int operation -- EPOLL_CTL_ADD, _MOD or _DEL
+**              int sock -- socket to change
+**              int interest -- REACTOR_* bits to watch it for
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if epoll_ctl failed
+**
+** Notes:
+** Makes one epoll_ctl call and remembers the interest.
+**********************************************************************/
+int EpollReactor::control(int operation, int sock, int interest)
+{
+    struct epoll_event event;
+
+    event.events = ((interest & REACTOR_READ) ? (unsigned int) EPOLLIN : 0) | ((interest & REACTOR_WRITE) ? (unsigned int) EPOLLOUT : 0);
+    event.data.fd = sock;
+
+    if (epoll_ctl(epollDescriptor, operation, sock, &event) == -1)
+    {
+        return -1;
+    }
+
+    if (sock >= (int) interests.size())
+    {
+        interests.resize(sock + 1, 0);
+    }
+    interests[sock] = interest;
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: wait
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int wait(int timeout)
+**              int timeout -- most milliseconds to block, -1 for no limit
+**
+** Returns:
+**			int -- number of events collected
+**              -- -1 if epoll_wait failed or was interrupted
+**
+** Notes:
+** Collects what one epoll_wait returns, and sizes the next batch
+** from how full this one was.
+**********************************************************************/
+int EpollReactor::wait(int timeout)
+{
+    struct epoll_event *events = batch.getEvents();
+    int numReady = epoll_wait(epollDescriptor, events, batch.getCapacity(), timeout);
+    ReactorEvent event;
+
+    for (int i = 0; i < numReady; i++)
+    {
+        event.sock = events[i].data.fd;
+        event.events = readyFor(events[i].events, interests[event.sock]);
+        if (event.events != 0)
+        {
+            ready.push_back(event);
+        }
+    }
+    batch.record(numReady);
+
+    return numReady < 0 ? numReady : (int) ready.size();
+}
@@ -0,0 +1,249 @@
+/**********************************************************************
+**	SOURCE FILE:	poll_reactor.cpp - Reactor backend built on poll
+**
+**	PROGRAM:	Scalable Server -- Reactor based
+**
+**	FUNCTIONS:
+**      const char *getName();
+**      int registerSocket(int, int);
+**      int modifySocket(int, int);
+**      int deregisterSocket(int);
+**      int wait(int);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** poll as a backend (-e poll). pollSet is handed to poll as it
+** stands: registering appends an entry, deregistering moves the last
+** entry into the hole, and modifying rewrites one entry's events, so
+** nothing is rebuilt between calls and there is no limit on
+** descriptor numbers.
+*************************************************************************/
+#include "reactor.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: getName
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    const char *getName()
+**
+** Returns:
+**			const char * -- name -e selects the backend by
+**
+** Notes:
+** Names the poll backend.
+**********************************************************************/
+const char *PollReactor::getName()
+{
+    return "poll";
+}
+
+
+/*****************************************************************
+** Function: registerSocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int registerSocket(int sock, int interest)
+**              int sock -- socket to watch
+**              int interest -- REACTOR_* bits to watch it for
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 for a negative descriptor
+**
+** Notes:
+** Appends the socket to pollSet.
+**********************************************************************/
+int PollReactor::registerSocket(int sock, int interest)
+{
+    if (sock < 0)
+    {
+        return -1;
+    }
+
+    if (sock >= (int) positions.size())
+    {
+        positions.resize(sock + 1, -1);
+    }
+
+    struct pollfd entry;
+    entry.fd = sock;
+    entry.events = 0;
+    entry.revents = 0;
+
+    positions[sock] = pollSet.size();
+    pollSet.push_back(entry);
+
+    return modifySocket(sock, interest);
+}
+
+
+/*****************************************************************
+** Function: modifySocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int modifySocket(int sock, int interest)
+**              int sock -- registered socket
+**              int interest -- REACTOR_* bits to watch it for now
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if the socket is not registered
+**
+** Notes:
+** Rewrites the socket's entry in place.
+**********************************************************************/
+int PollReactor::modifySocket(int sock, int interest)
+{
+    if (sock < 0 || sock >= (int) positions.size() || positions[sock] == -1)
+    {
+        return -1;
+    }
+
+    struct pollfd &entry = pollSet[positions[sock]];
+
+    entry.events = 0;
+    if (interest & REACTOR_READ)
+    {
+        entry.events |= POLLIN;
+    }
+    if (interest & REACTOR_WRITE)
+    {
+        entry.events |= POLLOUT;
+    }
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: deregisterSocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int deregisterSocket(int sock)
+**              int sock -- registered socket
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if the socket is not registered
+**
+** Notes:
+** Moves the last entry of pollSet into the socket's place.
+**********************************************************************/
+int PollReactor::deregisterSocket(int sock)
+{
+    if (sock < 0 || sock >= (int) positions.size() || positions[sock] == -1)
+    {
+        return -1;
+    }
+
+    int index = positions[sock];
+
+    positions[sock] = -1;
+    pollSet[index] = pollSet.back();
+    pollSet.pop_back();
+
+    if (index < (int) pollSet.size())
+    {
+        positions[pollSet[index].fd] = index;
+    }
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: wait
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int wait(int timeout)
+**              int timeout -- most milliseconds to block, -1 for no limit
+**
+** Returns:
+**			int -- number of events collected
+**              -- -1 if poll failed or was interrupted
+**
+** Notes:
+** Polls the whole set and collects the entries with events, stopping
+** once poll's count of them has been found.
+**********************************************************************/
+int PollReactor::wait(int timeout)
+{
+    int numReady = poll(pollSet.data(), pollSet.size(), timeout);
+    ReactorEvent event;
+
+    for (size_t i = 0; i < pollSet.size() && numReady > 0; i++)
+    {
+        if (pollSet[i].revents == 0)
+        {
+            continue;
+        }
+        numReady--;
+
+        int interest = ((pollSet[i].events & POLLIN) ? REACTOR_READ : 0)
+                     | ((pollSet[i].events & POLLOUT) ? REACTOR_WRITE : 0);
+
+        event.sock = pollSet[i].fd;
+        event.events = readyFor(pollSet[i].revents, interest);
+        if (event.events != 0)
+        {
+            ready.push_back(event);
+        }
+    }
+
+    return numReady < 0 ? numReady : (int) ready.size();
+}
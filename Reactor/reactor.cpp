@@ -0,0 +1,217 @@
+/**********************************************************************
+**	SOURCE FILE:	reactor.cpp - Readiness interface shared by the engines
+**
+**	PROGRAM:	Scalable Server -- Reactor based
+**
+**	FUNCTIONS:
+**      bool open();
+**      int dispatch(void (*)(int, int));
+**      static int readyFor(int, int);
+**      Reactor *createReactor(const char *, int);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** The server is the same whichever call it waits with. A Reactor is
+** that wait on its own: sockets are registered for REACTOR_READ
+** and/or REACTOR_WRITE, the interest is changed with modifySocket,
+** and deregisterSocket drops a socket before it is closed. wait
+** blocks for at most the given milliseconds (-1 for no limit) and
+** collects the ready sockets; dispatch then hands each to the server.
+**
+** Every backend is level triggered: a socket that is still ready is
+** reported again by the next wait. An error or hang-up is reported as
+** whichever of reading and writing the socket is watched for, so the
+** server finds it on its next recv or send. A socket closed while its
+** event waits to be dispatched may be reported once more, possibly
+** after its descriptor has been reused; the server treats every
+** report as a hint and uses non-blocking sockets.
+**
+** The backends, chosen by name with createReactor, are in
+** select_reactor.cpp, poll_reactor.cpp, epoll_reactor.cpp and
+** uring_reactor.cpp.
+*************************************************************************/
+#include <cstring>
+#include "reactor.h"
+
+using namespace std;
+
+
+Reactor::~Reactor()
+{
+}
+
+
+/*****************************************************************
+** Function: open
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    bool open()
+**
+** Returns:
+**			bool -- true if the reactor is ready for use
+**               -- false if the kernel refused it
+**
+** Notes:
+** Sets up what the backend needs from the kernel. select and poll
+** need nothing.
+**********************************************************************/
+bool Reactor::open()
+{
+    return true;
+}
+
+
+/*****************************************************************
+** Function: dispatch
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int dispatch(void (*handle)(int, int))
+**              void (*handle)(int, int) -- called with each socket
+**                  and what it is ready for
+**
+** Returns:
+**			int -- number of events handed out
+**
+** Notes:
+** Hands out the events the last wait collected, in the order the
+** kernel reported them. The handler may register, modify and
+** deregister sockets as it goes.
+**********************************************************************/
+int Reactor::dispatch(void (*handle)(int, int))
+{
+    int handled = ready.size();
+
+    for (int i = 0; i < handled; i++)
+    {
+        handle(ready[i].sock, ready[i].events);
+    }
+
+    ready.clear();
+    return handled;
+}
+
+
+/*****************************************************************
+** Function: readyFor
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static int readyFor(int revents, int interest)
+**              int revents -- poll bits the kernel reported
+**              int interest -- REACTOR_* bits the socket is watched for
+**
+** Returns:
+**			int -- REACTOR_* bits to report
+**
+** Notes:
+** poll, epoll and io_uring all report in poll bits. An error or
+** hang-up counts as ready for whatever the socket is watched for.
+**********************************************************************/
+int Reactor::readyFor(int revents, int interest)
+{
+    int events = 0;
+
+    if (revents & (POLLIN | POLLERR | POLLHUP))
+    {
+        events |= REACTOR_READ;
+    }
+    if (revents & (POLLOUT | POLLERR | POLLHUP))
+    {
+        events |= REACTOR_WRITE;
+    }
+
+    return events & interest;
+}
+
+
+/*****************************************************************
+** Function: createReactor
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    Reactor *createReactor(const char *name, int maxEvents)
+**              const char *name -- select, poll, epoll or uring
+**              int maxEvents -- most events an epoll wait may return
+**
+** Returns:
+**			Reactor * -- a ready reactor, to be deleted by the caller
+**              -- NULL if the name is unknown or the reactor could
+**                 not be set up
+**
+** Notes:
+** Builds the backend chosen at run time.
+**********************************************************************/
+Reactor *createReactor(const char *name, int maxEvents)
+{
+    Reactor *reactor;
+
+    if (strcmp(name, "select") == 0)
+    {
+        reactor = new SelectReactor();
+    }
+    else if (strcmp(name, "poll") == 0)
+    {
+        reactor = new PollReactor();
+    }
+    else if (strcmp(name, "epoll") == 0)
+    {
+        reactor = new EpollReactor(maxEvents);
+    }
+    else if (strcmp(name, "uring") == 0)
+    {
+        reactor = new UringReactor();
+    }
+    else
+    {
+        return NULL;
+    }
+
+    if (!reactor->open())
+    {
+        delete reactor;
+        return NULL;
+    }
+
+    return reactor;
+}
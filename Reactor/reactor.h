@@ -0,0 +1,158 @@
+#ifndef REACTOR_H
+#define REACTOR_H
+
+#include <vector>
+#include <sys/select.h>
+#include <sys/epoll.h>
+#include <poll.h>
+#include <linux/time_types.h>
+#include "uring.h"
+#include "event_batch.h"
+
+//what a socket is watched for, and what wait found it ready for
+#define REACTOR_READ 1
+#define REACTOR_WRITE 2
+
+//io_uring submission and completion queue sizes
+#define REACTOR_URING_ENTRIES 4096
+#define REACTOR_URING_COMPLETIONS (REACTOR_URING_ENTRIES * 4)
+
+/** A socket the last wait found ready **/
+struct ReactorEvent
+{
+    int sock;
+    int events;
+};
+
+/** Watches sockets for readiness, whatever the system call underneath **/
+class Reactor
+{
+    public:
+        virtual ~Reactor();
+        virtual const char *getName() = 0;
+        virtual bool open();
+
+        /** Interest **/
+        virtual int registerSocket(int, int) = 0;
+        virtual int modifySocket(int, int) = 0;
+        virtual int deregisterSocket(int) = 0;
+
+        /** Waiting **/
+        virtual int wait(int) = 0;
+        int dispatch(void (*)(int, int));
+
+    protected:
+        static int readyFor(int, int);
+
+        //sockets the last wait found ready
+        std::vector<ReactorEvent> ready;
+};
+
+/** select: one fd_set per kind of interest, FD_SETSIZE descriptors at most **/
+class SelectReactor : public Reactor
+{
+    public:
+        SelectReactor();
+        const char *getName();
+
+        int registerSocket(int, int);
+        int modifySocket(int, int);
+        int deregisterSocket(int);
+        int wait(int);
+
+    private:
+        fd_set readInterest;
+        fd_set writeInterest;
+        fd_set readReady;
+        fd_set writeReady;
+
+        //highest descriptor in either interest set
+        int maxDescriptor;
+};
+
+/** poll: a packed pollfd array kept up to date as sockets come and go **/
+class PollReactor : public Reactor
+{
+    public:
+        const char *getName();
+
+        int registerSocket(int, int);
+        int modifySocket(int, int);
+        int deregisterSocket(int);
+        int wait(int);
+
+    private:
+        std::vector<struct pollfd> pollSet;
+
+        //where each descriptor sits in pollSet, -1 if it is not there
+        std::vector<int> positions;
+};
+
+/** epoll, level triggered **/
+class EpollReactor : public Reactor
+{
+    public:
+        EpollReactor(int);
+        ~EpollReactor();
+        const char *getName();
+        bool open();
+
+        int registerSocket(int, int);
+        int modifySocket(int, int);
+        int deregisterSocket(int);
+        int wait(int);
+
+    private:
+        int control(int, int, int);
+
+        int epollDescriptor;
+
+        //what epoll_wait fills, sized to how busy the wakeups are
+        EventBatch batch;
+
+        //interest by descriptor, to sort errors into reads and writes
+        std::vector<int> interests;
+};
+
+/** io_uring state for one registered socket **/
+struct UringWatch
+{
+    int interest;
+    unsigned int generation;
+    bool registered;
+    bool armed;
+    bool queued;
+};
+
+/** io_uring: a one-shot poll per socket, armed again after each report **/
+class UringReactor : public Reactor
+{
+    public:
+        const char *getName();
+        bool open();
+
+        int registerSocket(int, int);
+        int modifySocket(int, int);
+        int deregisterSocket(int);
+        int wait(int);
+
+    private:
+        struct io_uring_sqe * nextSqe();
+        void queueArm(int);
+        void disarm(int);
+
+        URing ring;
+
+        //by descriptor
+        std::vector<UringWatch> watches;
+
+        //sockets whose poll is to be submitted by the next wait
+        std::vector<int> arming;
+
+        //timeout of the wait in progress, read by the kernel on submit
+        struct __kernel_timespec waitTime;
+};
+
+Reactor *createReactor(const char *, int);
+
+#endif //REACTOR_H
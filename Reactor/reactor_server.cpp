@@ -0,0 +1,2427 @@
+/**********************************************************************
+**	SOURCE FILE:	reactor_server.cpp - One server over any readiness engine
+**
+**	PROGRAM:	Scalable Server -- Reactor based
+**
+**	FUNCTIONS:
+** int applyOption(int, const char *)
+** void printUsage(const char *)
+** int raiseFileLimit()
+** int setSocketBuffers(int)
+** int openListener(TCPSocket &, bool, int)
+** int adoptListeners(std::vector<int> &)
+** void closeListeners()
+** int assignCpus(int)
+** int pinWorker(int)
+** int createChildren(int)
+** pid_t spawnWorker(int)
+** int createThreads(int)
+** void *workerThread(void *)
+** int runWorker()
+** int sampleStats()
+** int drainWorkers()
+** void reportConnected()
+** void reportDone()
+** void reportEchoed(unsigned long long)
+** bool drainRequested()
+** unsigned long long beginDrain(int)
+** int reactorState()
+** int waitForEvents(int)
+** void controlHandler(int)
+** void handleEvent(int, int)
+** int acceptClients()
+** int readClient(Connection *)
+** int spliceClient(Connection *)
+** int writeClient(Connection *)
+** int updateInterest(Connection *)
+** void closeClient(Connection *)
+** void expireClient(void *)
+** int drainClients()
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** The server, written once against the Reactor interface (reactor.cpp)
+** in place of the old Select, EPoll and Basic servers; -e picks the
+** wait at run time: select, poll, epoll (the default) or uring.
+** Everything around the wait -- accepting, reading, the handlers,
+** output queueing, idle timers, draining and reporting -- is the same
+** code for all four, so runs with different engines compare the
+** engines alone. -e uring-echo runs the completion based io_uring echo
+** engine (uring_server.cpp) instead of a reactor.
+**
+** Settings are given by short letter, by long name, or in a config
+** file given with -c; the command line overrides the file. The listen
+** address (-l), port (-p), backlog (-k), epoll batch limit (-n), read
+** buffer size (-s) and io_uring buffer size (-u) default to the values
+** in reactor_server.h.
+**
+** The parent supervises forked workers, each of which has its own
+** reactor over the shared listener; one that dies is reaped, its exit
+** reason logged and a replacement forked into the same slot, with a
+** back-off that grows while the slot keeps dying young. Run with
+** -m thread to run the workers as threads of one process instead;
+** each thread still owns its reactor, connection table and timers.
+** -w sets the number of workers, which defaults to MIN_FREE_PROCESSES
+** processes or one thread per online CPU.
+**
+** Run with -r to give every worker its own SO_REUSEPORT listener
+** instead of sharing a single one; the kernel then hashes new
+** connections across the workers so an accept only wakes one of them.
+** Run with -a to pin each worker to one of the CPUs the server may run
+** on, round robin. Combined with -r every worker's listener is also
+** tagged with SO_INCOMING_CPU for that CPU.
+**
+** SIGTERM drains the server instead of stopping it: every worker stops
+** accepting and closes its clients as they go quiet, closing what it
+** has left after -d seconds; SIGINT still stops everything at once.
+** Run with -H path for zero-downtime restarts: the server offers its
+** listeners on a Unix socket at the path, and a new server started
+** with the same -H takes them over and lets this one drain. Keep -r
+** and -w the same across a restart. The parent prints one summary
+** line every -i milliseconds unless -q is given, including the user
+** memory the clients cost.
+**
+** Every backend is level triggered. A client is read from for at most
+** -b bytes per wakeup and is simply reported again next time if more
+** is waiting, so the level does the old EPoll server's ready list's
+** job of taking busy clients in turn; the cost is one extra report per
+** busy client per wakeup, where the ready list revisited it without
+** asking the kernel. The listener works the same way: at most
+** ACCEPT_BATCH clients are accepted per wakeup instead of draining the
+** backlog to EAGAIN, and the reactor reports it again while more are
+** waiting, so a flood of connects cannot starve the clients already
+** open. Clients are found through the fd-indexed ConnectionTable
+** (connection_table.cpp), which takes the place of the old Select
+** server's packed client list and free-slot stack.
+**
+** Output the socket cannot take is queued on the client's Connection
+** (connection.cpp) and the client watched for writing until the queue
+** empties; with OUTPUT_HIGH_WATERMARK bytes queued it is not read from
+** until the queue drops to OUTPUT_LOW_WATERMARK.
+** Run with -y usec to busy-poll: a worker about to block waits with a
+** zero timeout for that long first, trading a core for lower wakeup
+** latency.
+**
+** What the workers say to their clients is up to the handler chosen
+** with -x (see handler.cpp): echo by default, framed for length-
+** prefixed messages (framing.cpp) or http for load tools (http.cpp).
+** Run with -z to echo with splice() instead of recv and send, so the
+** bytes never enter user space; a client that cannot take all of its
+** echo keeps the worker's pipe, with the rest still inside, and is not
+** read from again until it has drained. The splice and uring-echo
+** paths echo by themselves and only run with echo. A client that
+** sends nothing for -t seconds is closed.
+**
+** Run with -C for a million mostly idle clients: every socket gets
+** C1M_SOCKET_BUFFER bytes of kernel buffer each way unless -B says
+** otherwise (-B also works on its own). A client costs its Connection
+** record and one pointer in the descriptor index; output storage is
+** lent from a per-worker pool only while something is queued. Every
+** engine but select raises the open file limit as far as it goes;
+** select cannot watch a descriptor past FD_SETSIZE, and clients beyond
+** it are turned away.
+*************************************************************************/
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <atomic>
+#include "config.h"
+#include "tcpsocket.h"
+#include "stats.h"
+#include "timer_wheel.h"
+#include "connection.h"
+#include "connection_table.h"
+#include "pipe_pool.h"
+#include "supervisor.h"
+#include "handoff.h"
+#include "handler.h"
+#include "uring_server.h"
+#include "reactor.h"
+#include "reactor_server.h"
+
+using namespace std;
+
+/** Listening socket for new clients **/
+TCPSocket listenSocket;
+
+/** Listener and buffer settings (-l, -p, -k, -n, -s, -u) **/
+string listenAddress;
+int listenPort = LISTENING_PORT;
+int backlog = MAX_QUEUED;
+int epollBatch = EPOLL_QUEUE_LEN;
+int bufferSize = BUFFER_LENGTH;
+int uringBufferSize = URING_BUFFER_SIZE;
+
+/** Microseconds to spin on the reactor before blocking (-y, 0 for off) **/
+int busyPollWindow = 0;
+
+/** Options, by short letter and by config file / long name **/
+const char *SHORT_OPTIONS = "c:l:p:k:n:s:u:y:razb:e:m:w:i:t:d:H:x:CB:q";
+const struct option longOptions[] =
+{
+    {"config", required_argument, NULL, 'c'},
+    {"address", required_argument, NULL, 'l'},
+    {"port", required_argument, NULL, 'p'},
+    {"backlog", required_argument, NULL, 'k'},
+    {"batch", required_argument, NULL, 'n'},
+    {"buffer", required_argument, NULL, 's'},
+    {"uring-buffer", required_argument, NULL, 'u'},
+    {"busy-poll", required_argument, NULL, 'y'},
+    {"reuseport", no_argument, NULL, 'r'},
+    {"affinity", no_argument, NULL, 'a'},
+    {"splice", no_argument, NULL, 'z'},
+    {"budget", required_argument, NULL, 'b'},
+    {"engine", required_argument, NULL, 'e'},
+    {"model", required_argument, NULL, 'm'},
+    {"workers", required_argument, NULL, 'w'},
+    {"interval", required_argument, NULL, 'i'},
+    {"idle", required_argument, NULL, 't'},
+    {"drain", required_argument, NULL, 'd'},
+    {"handoff", required_argument, NULL, 'H'},
+    {"handler", required_argument, NULL, 'x'},
+    {"c1m", no_argument, NULL, 'C'},
+    {"socket-buffer", required_argument, NULL, 'B'},
+    {"quiet", no_argument, NULL, 'q'},
+    {NULL, 0, NULL, 0}
+};
+
+/** Worker event engine (-e select|poll|epoll|uring|uring-echo) **/
+string engineName = DEFAULT_ENGINE;
+
+/** Worker model (-m process|thread) and count (-w) **/
+bool useThreads = false;
+int workerCount = 0;
+vector<pthread_t> threads;
+
+/** Bytes read from one client per wakeup (-b, 0 for no limit) **/
+int readBudget = READ_BUDGET;
+
+/** Zero-copy splice echo (-z) **/
+bool useSplice = false;
+
+/** What the workers do with their clients (-x name) **/
+Handler *handler = NULL;
+
+/** Million-client mode (-C) and kernel buffer per socket (-B, 0 for the default) **/
+bool c1mMode = false;
+int socketBuffer = 0;
+
+/** Per-worker SO_REUSEPORT listeners (-r) **/
+bool perWorkerListeners = false;
+vector<TCPSocket> workerListeners;
+
+/** Worker CPU pinning (-a); CPU of each worker by index **/
+bool pinWorkers = false;
+vector<int> workerCpus;
+
+/** Shared memory counters for communication **/
+WorkerStats *sharedStats;
+vector<WorkerRecord> workers;
+
+/** Seconds a draining worker has to finish its clients (-d) **/
+int drainTimeout = DRAIN_TIMEOUT_SECONDS;
+
+/** Listener handoff for restarts (-H path) **/
+string handoffPath;
+int handoffSocket = -1;
+bool handedOff = false;
+
+//set by SIGTERM, or once a new server has taken the listeners
+volatile sig_atomic_t draining = 0;
+
+//thread model: workers still running, and how many stopped accepting
+atomic<int> runningThreads(0);
+atomic<int> releasedListeners(0);
+bool listenersClosed = false;
+
+/** Console reporting (-i interval in ms, -q to switch off) **/
+int reportInterval = REPORT_INTERVAL_MS;
+bool reportingEnabled = true;
+
+/** Idle client deadlines (-t seconds, 0 to disable) **/
+unsigned long long idleTimeout = IDLE_TIMEOUT_SECONDS * 1000ULL;
+
+//fork return for signal checking
+int pId;
+
+/* Signal handler structures */
+struct sigaction SA;
+struct sigaction old;
+
+/** Worker state; thread_local so each worker thread has its own **/
+thread_local int workerIndex;
+thread_local WorkerStats *workerStats;
+
+//listener this worker accepts from, -1 once it has stopped accepting
+thread_local int workerListener = -1;
+
+thread_local Reactor *reactor = NULL;
+
+//per-client state, indexed by socket descriptor
+thread_local ConnectionTable connections;
+
+//empty pipe the splice echo passes through, and the spares
+thread_local int echoPipe[2] = {-1, -1};
+thread_local PipePool pipes;
+
+//recv buffer shared by every client of a worker
+thread_local vector<char> readBuffer;
+
+//client deadlines
+thread_local TimerWheel timers;
+
+//time of the latest wakeup
+thread_local unsigned long long now;
+
+//this worker has stopped accepting and must be done by the deadline
+thread_local bool drainStarted = false;
+thread_local unsigned long long drainDeadline;
+
+/*****************************************************************
+** Function: main
+**
+** Date: February 8th, 2016
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		     int main(int argc, char *argv[])
+**              int argc -- number of command line arguments
+**              char *argv[] -- command line arguments
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if an error occurs
+**
+** Notes:
+** Checks the chosen engine works here, connects the listening
+** socket(s) and creates the pool of workers that will be handling
+** clients.
+**********************************************************************/
+int main(int argc, char *argv[])
+{
+    //settings from the config file and command line
+    if (parseOptions(argc, argv, SHORT_OPTIONS, longOptions, applyOption) == RETURN_ERROR)
+    {
+        printUsage(argv[0]);
+        return RETURN_ERROR;
+    }
+
+    if (handler == NULL)
+    {
+        handler = findHandler(DEFAULT_HANDLER);
+    }
+
+    //splice and io_uring echo without ever handing the bytes to a handler
+    if ((useSplice || engineName == "uring-echo") && strcmp(handler->getName(), "echo") != 0)
+    {
+        cerr << "The " << handler->getName() << " handler needs a readiness engine without -z." << endl;
+        return RETURN_ERROR;
+    }
+
+    //fail now rather than in every worker, e.g. io_uring switched off
+    Reactor *probe = createReactor(engineName == "uring-echo" ? "uring" : engineName.c_str(), epollBatch);
+    if (probe == NULL)
+    {
+        cerr << "The " << engineName << " engine is not available here." << endl;
+        return RETURN_ERROR;
+    }
+    delete probe;
+
+    //select could not use more descriptors anyway
+    if (engineName != "select")
+    {
+        raiseFileLimit();
+    }
+
+    //small kernel buffers on each of a million sockets
+    if (c1mMode)
+    {
+        if (socketBuffer == 0)
+        {
+            socketBuffer = C1M_SOCKET_BUFFER;
+        }
+        printf("Each idle client costs %d bytes of user memory.\n", (int) (sizeof(Connection) + sizeof(Connection *)));
+    }
+
+    //match the thread count to the hardware unless told otherwise
+    if (workerCount == 0)
+    {
+        workerCount = useThreads ? sysconf(_SC_NPROCESSORS_ONLN) : MIN_FREE_PROCESSES;
+        if (workerCount <= 0)
+        {
+            workerCount = 1;
+        }
+    }
+
+    //spread the workers over the CPUs we are allowed on
+    if (pinWorkers && assignCpus(workerCount) == RETURN_ERROR)
+    {
+        return RETURN_ERROR;
+    }
+
+    //take the listeners over from the server we are replacing
+    vector<int> inherited;
+    int handoffPeer = -1;
+    if (!handoffPath.empty())
+    {
+        handoffPeer = requestListeners(handoffPath.c_str(), inherited);
+    }
+
+    if (handoffPeer >= 0)
+    {
+        if (adoptListeners(inherited) == SOCKET_ERROR)
+        {
+            return SOCKET_ERROR;
+        }
+    }
+    else if (perWorkerListeners)
+    {
+        //bind one listener per worker on the same port
+        workerListeners.resize(workerCount);
+        for (int i = 0; i < workerCount; i++)
+        {
+            if (openListener(workerListeners[i], true, pinWorkers ? workerCpus[i] : -1) == SOCKET_ERROR)
+            {
+                return SOCKET_ERROR;
+            }
+        }
+    }
+    else if (openListener(listenSocket, false, -1) == SOCKET_ERROR)
+    {
+        return SOCKET_ERROR;
+    }
+
+    //map the counters the workers report through
+    if ((sharedStats = createSharedStats(workerCount)) == NULL)
+    {
+        cerr << "Unable to create shared counters." << endl;
+        exit(RETURN_ERROR);
+    }
+
+    //set up signal handler
+	SA.sa_handler = controlHandler;
+	sigemptyset(&SA.sa_mask);
+	sigaction(SIGINT, &SA, &old);
+
+    //a dying worker wakes the parent to replace it
+    sigaction(SIGCHLD, &SA, NULL);
+
+    //SIGTERM drains the workers before the server exits
+    sigaction(SIGTERM, &SA, NULL);
+
+    printf("Workers wait with %s.\n", engineName.c_str());
+
+    //create the workers
+    if (useThreads)
+    {
+        if (createThreads(workerCount) == RETURN_ERROR)
+        {
+            exit(RETURN_ERROR);
+        }
+    }
+    else
+    {
+        createChildren(workerCount);
+    }
+
+    //we are serving; let the old server drain
+    if (handoffPeer >= 0)
+    {
+        confirmHandoff(handoffPeer);
+        printf("Took over %d listener(s) from the running server.\n", (int) inherited.size());
+    }
+
+    //offer our listeners to the next restart
+    if (!handoffPath.empty() && (handoffSocket = openHandoff(handoffPath.c_str())) == -1)
+    {
+        cerr << "Unable to open the handoff socket; restarts will not be seamless." << endl;
+    }
+
+    //watch the workers' counters from the main process
+    sampleStats();
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: applyOption
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int applyOption(int option, const char *value)
+**              int option -- short letter of the setting
+**              const char *value -- its value, NULL for switches
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the value is invalid
+**
+** Notes:
+** Validates one setting from the command line or config file and
+** stores it.
+**********************************************************************/
+int applyOption(int option, const char *value)
+{
+    int number;
+
+    switch (option)
+    {
+        case 'l':
+        {
+            struct in_addr address;
+            if (inet_pton(AF_INET, value, &address) != 1)
+            {
+                cerr << "Invalid listen address: " << value << endl;
+                return RETURN_ERROR;
+            }
+            listenAddress = value;
+        }
+        break;
+
+        case 'p':
+            return parseNumber("port", value, 1, 65535, &listenPort);
+
+        case 'k':
+            return parseNumber("backlog", value, 1, 65535, &backlog);
+
+        case 'n':
+            return parseNumber("batch", value, 1, EPOLL_QUEUE_LEN, &epollBatch);
+
+        case 's':
+            return parseNumber("buffer", value, 1, 1 << 24, &bufferSize);
+
+        case 'u':
+            return parseNumber("uring-buffer", value, 1, 1 << 24, &uringBufferSize);
+
+        case 'y':
+            return parseNumber("busy-poll", value, 0, 1000000, &busyPollWindow);
+
+        case 'r':
+            perWorkerListeners = true;
+        break;
+
+        case 'a':
+            pinWorkers = true;
+        break;
+
+        case 'z':
+            useSplice = true;
+        break;
+
+        case 'b':
+            return parseNumber("budget", value, 0, INT_MAX, &readBudget);
+
+        case 'e':
+            if (strcmp(value, "select") != 0 && strcmp(value, "poll") != 0
+                && strcmp(value, "epoll") != 0 && strcmp(value, "uring") != 0
+                && strcmp(value, "uring-echo") != 0)
+            {
+                cerr << "Unknown engine: " << value << endl;
+                return RETURN_ERROR;
+            }
+            engineName = value;
+        break;
+
+        case 'm':
+            if (strcmp(value, "thread") == 0)
+            {
+                useThreads = true;
+            }
+            else if (strcmp(value, "process") == 0)
+            {
+                useThreads = false;
+            }
+            else
+            {
+                cerr << "Unknown worker model: " << value << endl;
+                return RETURN_ERROR;
+            }
+        break;
+
+        case 'w':
+            return parseNumber("workers", value, 1, MAX_WORKERS, &workerCount);
+
+        case 'i':
+            return parseNumber("interval", value, 1, INT_MAX / 1000, &reportInterval);
+
+        case 't':
+            if (parseNumber("idle", value, 0, INT_MAX, &number) == RETURN_ERROR)
+            {
+                return RETURN_ERROR;
+            }
+            idleTimeout = number * 1000ULL;
+        break;
+
+        case 'd':
+            return parseNumber("drain", value, 0, INT_MAX / 1000, &drainTimeout);
+
+        case 'H':
+            handoffPath = value;
+        break;
+
+        case 'x':
+            if ((handler = findHandler(value)) == NULL)
+            {
+                cerr << "Unknown handler: " << value << endl;
+                return RETURN_ERROR;
+            }
+        break;
+
+        case 'C':
+            c1mMode = true;
+        break;
+
+        case 'B':
+            return parseNumber("socket-buffer", value, 0, INT_MAX / 2, &socketBuffer);
+
+        case 'q':
+            reportingEnabled = false;
+        break;
+
+        default:
+            return RETURN_ERROR;
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: printUsage
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void printUsage(const char *program)
+**              const char *program -- name the server was run as
+**
+** Returns:
+**			void
+**
+** Notes:
+** Lists the settings the server takes.
+**********************************************************************/
+void printUsage(const char *program)
+{
+    cerr << "Usage: " << program << " [-c file] [-l address] [-p port] [-k backlog] [-n batch]" << endl
+         << "       [-s bytes] [-u bytes] [-y usec] [-r] [-a] [-z] [-b bytes]" << endl
+         << "       [-e select|poll|epoll|uring|uring-echo] [-m process|thread] [-w workers]" << endl
+         << "       [-i ms] [-t seconds] [-d seconds] [-H path] [-x handler] [-C] [-B bytes] [-q]" << endl;
+}
+
+/*****************************************************************
+** Function: raiseFileLimit
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int raiseFileLimit()
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the limit could not be raised
+**
+** Notes:
+** Raises the open file limit as far as it will go: to the kernel's
+** fs.nr_open if the server is allowed to raise its hard limit,
+** otherwise to the hard limit it has. The workers inherit it.
+**********************************************************************/
+int raiseFileLimit()
+{
+    struct rlimit limit;
+    unsigned long long systemMax = 0;
+    FILE *nrOpen = fopen("/proc/sys/fs/nr_open", "r");
+
+    if (nrOpen != NULL)
+    {
+        if (fscanf(nrOpen, "%llu", &systemMax) != 1)
+        {
+            systemMax = 0;
+        }
+        fclose(nrOpen);
+    }
+
+    if (getrlimit(RLIMIT_NOFILE, &limit) == -1)
+    {
+        perror("getrlimit");
+        return RETURN_ERROR;
+    }
+
+    //no descriptor can go past nr_open, whatever the hard limit says
+    if (systemMax > 0 && (limit.rlim_max == RLIM_INFINITY || limit.rlim_max > systemMax))
+    {
+        limit.rlim_max = systemMax;
+    }
+
+    //a privileged server may lift its hard limit too
+    if (systemMax > limit.rlim_max)
+    {
+        struct rlimit raised;
+        raised.rlim_cur = raised.rlim_max = systemMax;
+
+        if (setrlimit(RLIMIT_NOFILE, &raised) == 0)
+        {
+            limit = raised;
+        }
+    }
+
+    limit.rlim_cur = limit.rlim_max;
+    if (setrlimit(RLIMIT_NOFILE, &limit) == -1)
+    {
+        perror("setrlimit");
+        return RETURN_ERROR;
+    }
+
+    printf("Open file limit raised to %llu.\n", (unsigned long long) limit.rlim_cur);
+    return 0;
+}
+
+/*****************************************************************
+** Function: setSocketBuffers
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int setSocketBuffers(int listener)
+**              int listener -- listening socket
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if an error occurs
+**
+** Notes:
+** Sets the kernel receive and send buffers to -B bytes. Set on the
+** listener, the size is inherited by every client it accepts, so no
+** call is spent per connection. A fixed size also turns off the
+** kernel's buffer autotuning, which would otherwise let a busy socket
+** grow to megabytes.
+**********************************************************************/
+int setSocketBuffers(int listener)
+{
+    if (socketBuffer == 0)
+    {
+        return 0;
+    }
+
+    if (setsockopt(listener, SOL_SOCKET, SO_RCVBUF, &socketBuffer, sizeof(socketBuffer)) == -1
+        || setsockopt(listener, SOL_SOCKET, SO_SNDBUF, &socketBuffer, sizeof(socketBuffer)) == -1)
+    {
+        perror("setsockopt(SO_RCVBUF/SO_SNDBUF)");
+        return SOCKET_ERROR;
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: openListener
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int openListener(TCPSocket &listener, bool reusePort, int incomingCpu)
+**              TCPSocket &listener -- socket to bind and listen on
+**              bool reusePort -- true to bind with SO_REUSEPORT
+**              int incomingCpu -- CPU whose connections this listener
+**                                 should get, -1 for any
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if an error occurs
+**
+** Notes:
+** Binds a listening socket to the server port, sets it into
+** non-blocking mode and starts listening. Within a SO_REUSEPORT group
+** the kernel prefers the listener whose SO_INCOMING_CPU matches the
+** CPU that received the connection.
+**********************************************************************/
+int openListener(TCPSocket &listener, bool reusePort, int incomingCpu)
+{
+    //initialize the listening socket & bind it
+    if (!listener.connectServer(listenPort, reusePort, listenAddress))
+    {
+        return SOCKET_ERROR;
+    }
+
+    //steer connections arriving on this CPU to this listener
+    if (incomingCpu >= 0 && setsockopt(listener.getSocketValue(), SOL_SOCKET, SO_INCOMING_CPU, &incomingCpu, sizeof(incomingCpu)) == -1)
+    {
+        perror("setsockopt(SO_INCOMING_CPU)");
+        return SOCKET_ERROR;
+    }
+
+    //sized before listen so the window scale suits the buffers
+    if (setSocketBuffers(listener.getSocketValue()) == SOCKET_ERROR)
+    {
+        return SOCKET_ERROR;
+    }
+
+    //set the listening socket into non blocking
+    if (fcntl(listener.getSocketValue(), F_SETFL, O_NONBLOCK | fcntl(listener.getSocketValue(), F_GETFL, 0)) == -1)
+    {
+        cerr << "Unable to set listening socket to non-blocking" << endl;
+        return SOCKET_ERROR;
+    }
+
+    //set the socket into listening mode
+    if(!listener.startListen(backlog))
+    {
+        return SOCKET_ERROR;
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: adoptListeners
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int adoptListeners(std::vector<int> &inherited)
+**              std::vector<int> &inherited -- listeners handed over by
+**                                            the old server
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if a missing listener could not be opened
+**
+** Notes:
+** Uses the old server's listening sockets in place of binding new
+** ones. With -r each worker takes the one in its slot and binds any
+** that are missing; without it the first one is shared. Listeners
+** left over are closed.
+**********************************************************************/
+int adoptListeners(vector<int> &inherited)
+{
+    int used = 1;
+
+    if (perWorkerListeners)
+    {
+        workerListeners.resize(workerCount);
+        used = inherited.size() < workerListeners.size() ? inherited.size() : workerListeners.size();
+
+        for (int i = 0; i < workerCount; i++)
+        {
+            int incomingCpu = pinWorkers ? workerCpus[i] : -1;
+
+            //more workers than the old server had
+            if (i >= used)
+            {
+                if (openListener(workerListeners[i], true, incomingCpu) == SOCKET_ERROR)
+                {
+                    return SOCKET_ERROR;
+                }
+                continue;
+            }
+
+            workerListeners[i].setSocketValue(inherited[i]);
+            if (incomingCpu >= 0 && setsockopt(inherited[i], SOL_SOCKET, SO_INCOMING_CPU, &incomingCpu, sizeof(incomingCpu)) == -1)
+            {
+                perror("setsockopt(SO_INCOMING_CPU)");
+            }
+        }
+    }
+    else
+    {
+        listenSocket.setSocketValue(inherited[0]);
+    }
+
+    if ((int) inherited.size() > used)
+    {
+        cerr << "Closing " << inherited.size() - used << " listener(s) no worker will take over." << endl;
+    }
+
+    for (int i = 0; i < (int) inherited.size(); i++)
+    {
+        //workers rely on the listeners not blocking
+        if (i < used)
+        {
+            fcntl(inherited[i], F_SETFL, O_NONBLOCK | fcntl(inherited[i], F_GETFL, 0));
+            setSocketBuffers(inherited[i]);
+        }
+        else
+        {
+            close(inherited[i]);
+        }
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: closeListeners
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void closeListeners()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Closes the parent's copies of the listening sockets. The port
+** stops taking connections once the workers have closed theirs, unless
+** a new server has taken them over.
+**********************************************************************/
+void closeListeners()
+{
+    if (listenersClosed)
+    {
+        return;
+    }
+    listenersClosed = true;
+
+    if (perWorkerListeners)
+    {
+        for (int i = 0; i < (int) workerListeners.size(); i++)
+        {
+            workerListeners[i].closeSocket();
+        }
+    }
+    else
+    {
+        listenSocket.closeSocket();
+    }
+}
+
+/*****************************************************************
+** Function: assignCpus
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int assignCpus(int numWorkers)
+**              int numWorkers -- number of workers to place
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the CPU list could not be read
+**
+** Notes:
+** Hands the CPUs in the server's affinity mask out to the workers in
+** turn, wrapping around when there are more workers than CPUs.
+**********************************************************************/
+int assignCpus(int numWorkers)
+{
+    cpu_set_t allowed;
+    vector<int> cpus;
+
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == -1)
+    {
+        perror("sched_getaffinity");
+        return RETURN_ERROR;
+    }
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+        if (CPU_ISSET(cpu, &allowed))
+        {
+            cpus.push_back(cpu);
+        }
+    }
+
+    workerCpus.resize(numWorkers);
+    for (int i = 0; i < numWorkers; i++)
+    {
+        workerCpus[i] = cpus[i % cpus.size()];
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: pinWorker
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int pinWorker(int cpu)
+**              int cpu -- CPU to run on
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 if the affinity could not be set
+**
+** Notes:
+** Restricts the calling worker thread or process to a single CPU.
+**********************************************************************/
+int pinWorker(int cpu)
+{
+    cpu_set_t mask;
+
+    CPU_ZERO(&mask);
+    CPU_SET(cpu, &mask);
+
+    if (sched_setaffinity(0, sizeof(mask), &mask) == -1)
+    {
+        perror("sched_setaffinity");
+        return RETURN_ERROR;
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: createChildren
+**
+** Date: February 4th, 2016
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int createChildren(int numChildren)
+**              int numChildren -- number of children to create
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 on a failure
+**
+** Notes:
+** Creates a number of child processes, each of which runs its own
+** event loop over its listener.
+**********************************************************************/
+int createChildren(int numChildren)
+{
+    workers.resize(numChildren);
+
+    //create all the workers
+    for (int i = 0; i < numChildren; i++)
+    {
+        if (spawnWorker(i) == -1)
+        {
+            return RETURN_ERROR;
+        }
+    }
+
+    printf("%d children created.\n", numChildren);
+    return 0;
+}
+
+/*****************************************************************
+** Function: spawnWorker
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    pid_t spawnWorker(int index)
+**              int index -- worker slot to fill
+**
+** Returns:
+**			pid_t -- process id of the new worker
+**                -- -1 if the fork failed
+**
+** Notes:
+** Forks the worker for one slot, at startup or to replace one that
+** died. The parent keeps every per-worker listener open so that a
+** replacement takes over its slot's listener, along with any
+** connections that queued on it while the slot was empty.
+**********************************************************************/
+pid_t spawnWorker(int index)
+{
+    pid_t processId = fork();
+
+    switch (processId)
+    {
+        //fork error
+        case -1:
+            cerr << "Error creating a child process." << endl;
+        break;
+
+        //child process
+        case 0:
+            pId = 0;
+            workerIndex = index;
+
+            //only the parent hands the listeners on
+            if (handoffSocket >= 0)
+            {
+                close(handoffSocket);
+            }
+
+            if (perWorkerListeners)
+            {
+                //keep only this worker's listener
+                for (int j = 0; j < (int) workerListeners.size(); j++)
+                {
+                    if (j != workerIndex)
+                    {
+                        workerListeners[j].closeSocket();
+                    }
+                }
+            }
+
+            _exit(runWorker() == RETURN_ERROR ? 1 : CHILD_EXIT);
+        break;
+
+        //parent process
+        default:
+            pId = processId;
+            recordSpawn(workers[index], processId, monotonicMillis());
+        break;
+    }
+
+    return processId;
+}
+
+/*****************************************************************
+** Function: createThreads
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int createThreads(int numThreads)
+**              int numThreads -- number of worker threads to start
+**
+** Returns:
+**			int -- 0 on successful return
+**              -- -1 on a failure
+**
+** Notes:
+** Starts the workers as threads of this process. The main thread
+** keeps the listeners open since the workers share its descriptors.
+**********************************************************************/
+int createThreads(int numThreads)
+{
+    threads.resize(numThreads);
+    runningThreads = numThreads;
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (pthread_create(&threads[i], NULL, workerThread, (void *) (long) i) != 0)
+        {
+            cerr << "Error creating a worker thread." << endl;
+            return RETURN_ERROR;
+        }
+    }
+
+    printf("%d threads created.\n", numThreads);
+    return 0;
+}
+
+/*****************************************************************
+** Function: workerThread
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void *workerThread(void *index)
+**              void *index -- worker number, cast to a pointer
+**
+** Returns:
+**			void * -- NULL once the worker stops
+**
+** Notes:
+** Entry point of a worker thread. Returns once the worker has
+** drained.
+**********************************************************************/
+void *workerThread(void *index)
+{
+    workerIndex = (int) (long) index;
+    runWorker();
+
+    //lets a draining main thread know when the last worker is done
+    runningThreads--;
+    return NULL;
+}
+
+/*****************************************************************
+** Function: runWorker
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int runWorker()
+**
+** Returns:
+**			int -- return value of the worker's event loop
+**
+** Notes:
+** Picks this worker's listener and counters, pins it if asked to,
+** then runs the selected event engine. Shared by the process and thread
+** models.
+**********************************************************************/
+int runWorker()
+{
+    if (perWorkerListeners)
+    {
+        workerListener = workerListeners[workerIndex].getSocketValue();
+    }
+    else
+    {
+        workerListener = listenSocket.getSocketValue();
+    }
+
+    //count this worker's clients in its own slot
+    workerStats = &sharedStats[workerIndex];
+
+    //keep the worker on the core its listener is steered to
+    if (pinWorkers)
+    {
+        pinWorker(workerCpus[workerIndex]);
+    }
+
+    //the completion engine runs its own loop
+    if (engineName == "uring-echo")
+    {
+        return uringState(workerListener, uringBufferSize, DRAIN_QUIET_MS, idleTimeout);
+    }
+    return reactorState();
+}
+
+/*****************************************************************
+** Function: sampleStats
+**
+** Date: February 8th, 2016
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int sampleStats()
+**
+** Returns:
+**			int -- 0 on successful return
+*               -- -1 on a failure
+**
+** Notes:
+** Reads the workers' shared counters every reportInterval
+** milliseconds and prints a one line summary of the interval, unless
+** reporting has been switched off with -q. In between it keeps the
+** worker processes supervised and hands the listeners to a new server
+** that asks for them. Returns once the server has drained.
+**********************************************************************/
+int sampleStats()
+{
+    cout << "===================================" << endl;
+    cout << "Waiting for connections:" << endl;
+    cout << "===================================" << endl;
+
+    StatsTotals last = StatsTotals();
+    struct timespec start, previous, now;
+    unsigned long long nextReport = monotonicMillis() + reportInterval;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    previous = start;
+
+    //keep sampling the counters
+    while (true)
+    {
+        //sleep in short steps so dead workers are replaced on time;
+        //SIGCHLD also cuts the sleep short
+        unsigned long long current = monotonicMillis();
+        if (current < nextReport)
+        {
+            unsigned long long wait = nextReport - current;
+            usleep((wait < SUPERVISE_INTERVAL_MS ? wait : SUPERVISE_INTERVAL_MS) * 1000);
+        }
+
+        //draining workers are not replaced
+        superviseWorkers(workers, sharedStats, draining ? NULL : spawnWorker);
+
+        //a new server is taking over
+        if (!draining && handoffSocket >= 0)
+        {
+            vector<int> listeners;
+            if (perWorkerListeners)
+            {
+                for (int i = 0; i < (int) workerListeners.size(); i++)
+                {
+                    listeners.push_back(workerListeners[i].getSocketValue());
+                }
+            }
+            else
+            {
+                listeners.push_back(listenSocket.getSocketValue());
+            }
+
+            if (offerListeners(handoffSocket, listeners) == 1)
+            {
+                handedOff = true;
+                draining = 1;
+            }
+        }
+
+        if (draining && drainWorkers() == 0)
+        {
+            printf("Drained; exiting.\n");
+            return 0;
+        }
+
+        if (monotonicMillis() < nextReport)
+        {
+            continue;
+        }
+        nextReport += reportInterval;
+
+        //reporting switched off for benchmarking
+        if (!reportingEnabled)
+        {
+            continue;
+        }
+
+        StatsTotals totals = sumStats(sharedStats, workerCount);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        printSummary(totals, last,
+                     (now.tv_sec - previous.tv_sec) + (now.tv_nsec - previous.tv_nsec) / 1e9,
+                     (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9);
+
+        last = totals;
+        previous = now;
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: drainWorkers
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int drainWorkers()
+**
+** Returns:
+**			int -- number of workers still running
+**
+** Notes:
+** Called by the parent on every pass while draining. The first call
+** stops offering the listeners and closes the parent's copies. Every
+** call signals the workers again, since a worker may have been about
+** to block when the last signal arrived; processes that outlive the
+** drain deadline by DRAIN_GRACE_MS are killed.
+**********************************************************************/
+int drainWorkers()
+{
+    static unsigned long long killAt = 0;
+    unsigned long long current = monotonicMillis();
+    int running;
+
+    if (killAt == 0)
+    {
+        killAt = current + drainTimeout * 1000ULL + DRAIN_GRACE_MS;
+
+        closeHandoff(handoffSocket, handoffPath.c_str(), !handedOff);
+        handoffSocket = -1;
+
+        printf("Draining %s.\n", handedOff ? "after handing the listeners over" : "on request");
+        cout.flush();
+    }
+
+    if (useThreads)
+    {
+        //the threads share the listeners; close them once none is watching
+        if (releasedListeners >= (int) threads.size())
+        {
+            closeListeners();
+        }
+
+        running = runningThreads;
+        for (int i = 0; running > 0 && i < (int) threads.size(); i++)
+        {
+            pthread_kill(threads[i], SIGTERM);
+        }
+        return running;
+    }
+
+    closeListeners();
+
+    running = runningWorkers(workers);
+    for (int i = 0; i < (int) workers.size(); i++)
+    {
+        if (workers[i].pid > 0)
+        {
+            kill(workers[i].pid, current >= killAt ? SIGKILL : SIGTERM);
+        }
+    }
+
+    return running;
+}
+
+/*****************************************************************
+** Function: reportConnected
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void reportConnected()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Counts a new client in this worker's shared counters.
+**********************************************************************/
+void reportConnected()
+{
+    countAccepted(workerStats);
+}
+
+/*****************************************************************
+** Function: reportDone
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void reportDone()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Counts a finished client in this worker's shared counters.
+**********************************************************************/
+void reportDone()
+{
+    countClosed(workerStats);
+}
+
+/*****************************************************************
+** Function: reportEchoed
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void reportEchoed(unsigned long long bytes)
+**              unsigned long long bytes -- bytes echoed back
+**
+** Returns:
+**			void
+**
+** Notes:
+** Counts echoed bytes in this worker's shared counters.
+**********************************************************************/
+void reportEchoed(unsigned long long bytes)
+{
+    countBytes(workerStats, bytes);
+}
+
+/*****************************************************************
+** Function: drainRequested
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    bool drainRequested()
+**
+** Returns:
+**			bool -- true once the worker should drain
+**
+** Notes:
+** Checked by the event engines on every pass.
+**********************************************************************/
+bool drainRequested()
+{
+    return draining != 0;
+}
+
+/*****************************************************************
+** Function: beginDrain
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    unsigned long long beginDrain(int listener)
+**              int listener -- listener the worker has stopped watching
+**
+** Returns:
+**			unsigned long long -- time the worker must be done by
+**
+** Notes:
+** Lets go of the worker's listener. A process closes its copy; a
+** thread shares it with the others, so it only reports that it is no
+** longer watching and the main thread closes it.
+**********************************************************************/
+unsigned long long beginDrain(int listener)
+{
+    if (useThreads)
+    {
+        releasedListeners++;
+    }
+    else
+    {
+        close(listener);
+    }
+
+    return monotonicMillis() + drainTimeout * 1000ULL;
+}
+
+/*****************************************************************
+** Function: reactorState
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int reactorState()
+**
+** Returns:
+**			int -- 0 once the worker has drained
+**              -- -1 if its reactor could not be set up
+**
+** Notes:
+** A worker's loop: waits on its reactor until the nearest client
+** deadline, expires idle clients and dispatches whatever is ready to
+** handleEvent. Records of clients closed during a pass are only
+** handed out again after it.
+**********************************************************************/
+int reactorState()
+{
+    if ((reactor = createReactor(engineName.c_str(), epollBatch)) == NULL)
+    {
+        cerr << "Unable to start the " << engineName << " engine." << endl;
+        return RETURN_ERROR;
+    }
+
+    if (reactor->registerSocket(workerListener, REACTOR_READ) == -1)
+    {
+        perror("Unable to watch the listener");
+        return RETURN_ERROR;
+    }
+
+    readBuffer.resize(bufferSize);
+
+    now = monotonicMillis();
+    timers.start(now);
+
+    while (true)
+    {
+        //close clients whose deadlines have passed
+        now = monotonicMillis();
+        timers.advance(now, expireClient);
+
+        //stop accepting; clients are closed as they go quiet
+        if (drainRequested() && !drainStarted)
+        {
+            drainStarted = true;
+            reactor->deregisterSocket(workerListener);
+            drainDeadline = beginDrain(workerListener);
+            workerListener = -1;
+        }
+
+        if (drainStarted && drainClients() == 0)
+        {
+            delete reactor;
+            return 0;
+        }
+
+        //block until a new connection, data or the next deadline
+        int timeout = timers.nextTimeout(now);
+
+        //wake up to close clients as they go quiet
+        if (drainStarted)
+        {
+            int remaining = drainDeadline > now ? drainDeadline - now : 0;
+            if (remaining > DRAIN_QUIET_MS)
+            {
+                remaining = DRAIN_QUIET_MS;
+            }
+            if (timeout < 0 || timeout > remaining)
+            {
+                timeout = remaining;
+            }
+        }
+
+        //timed out or interrupted otherwise
+        if (waitForEvents(timeout) > 0)
+        {
+            now = monotonicMillis();
+            reactor->dispatch(handleEvent);
+        }
+
+        //records closed in this pass are safe to hand out again
+        connections.recycle();
+        setUserBytes(workerStats, connections.getMemoryUsage());
+    }
+}
+
+/*****************************************************************
+** Function: waitForEvents
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int waitForEvents(int timeout)
+**              int timeout -- longest time to block in ms, -1 forever
+**
+** Returns:
+**			int -- number of ready sockets, as from the reactor
+**
+** Notes:
+** Waits on the worker's reactor. In busy-poll mode it first polls
+** without blocking for up to busyPollWindow microseconds, never past
+** the timeout, and then blocks for whatever is left of the timeout.
+**********************************************************************/
+int waitForEvents(int timeout)
+{
+    if (busyPollWindow > 0 && timeout != 0)
+    {
+        long long window = busyPollWindow;
+        long long elapsed;
+        struct timespec start, current;
+
+        //never spin past the next deadline
+        if (timeout > 0 && timeout * 1000LL < window)
+        {
+            window = timeout * 1000LL;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        do
+        {
+            int numReady = reactor->wait(0);
+            if (numReady != 0)
+            {
+                return numReady;
+            }
+
+            clock_gettime(CLOCK_MONOTONIC, &current);
+            elapsed = (current.tv_sec - start.tv_sec) * 1000000LL + (current.tv_nsec - start.tv_nsec) / 1000;
+        }
+        while (elapsed < window);
+
+        //block for the rest of the timeout
+        if (timeout > 0)
+        {
+            timeout = elapsed / 1000 >= timeout ? 0 : timeout - elapsed / 1000;
+        }
+    }
+
+    return reactor->wait(timeout);
+}
+
+/*****************************************************************
+** Function: controlHandler
+**
+** Date: February 2nd, 2016
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void controlHandler(int signal)
+**          int signal -- Signal that has been caught
+**
+** Returns:
+**			void
+**
+** Notes:
+** Catches a single (SIGINT generated by ctrl + z, SIGTERM asking for
+** a drain or children dying) and handles it appropriately.
+**********************************************************************/
+void controlHandler(int signal)
+{
+    if (signal == SIGINT)
+    {
+        if ( pId != 0)
+    	{
+    		//restore default signal handler
+    		sigaction(SIGINT, &old, NULL);
+
+            for (int i = 0; i < (int) workers.size(); i++)
+            {
+                //SIGTERM would only make them drain
+                if (workers[i].pid > 0)
+                {
+                    kill(workers[i].pid, SIGKILL);
+                }
+            }
+
+            if (!perWorkerListeners)
+            {
+                listenSocket.closeSocket();
+            }
+    	}
+        exit(0);
+    }
+
+    //parent and workers alike pick this up on their next pass
+    if (signal == SIGTERM)
+    {
+        draining = 1;
+    }
+
+    //SIGCHLD only needs to interrupt the parent's sleep; the dead
+    //worker is reaped by superviseWorkers
+}
+
+/*****************************************************************
+** Function: handleEvent
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void handleEvent(int socket, int events)
+**              int socket -- socket the reactor found ready
+**              int events -- REACTOR_* bits it is ready for
+**
+** Returns:
+**			void
+**
+** Notes:
+** Called by the reactor for every ready socket. Queued output goes
+** first, so a client that was held back for it can be read again in
+** the same pass. Reports for a client closed since the wait are
+** ignored.
+**********************************************************************/
+void handleEvent(int socket, int events)
+{
+    if (socket == workerListener)
+    {
+        acceptClients();
+        return;
+    }
+
+    Connection *client = connections.lookup(socket);
+    if (client == NULL)
+    {
+        return;
+    }
+
+    if ((events & REACTOR_WRITE) && writeClient(client) == -1)
+    {
+        return;
+    }
+
+    if ((events & REACTOR_READ) && (client->getEvents() & REACTOR_READ))
+    {
+        if (useSplice)
+        {
+            spliceClient(client);
+        }
+        else
+        {
+            readClient(client);
+        }
+    }
+}
+
+/*****************************************************************
+** Function: acceptClients
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int acceptClients()
+**
+** Returns:
+**			int -- number of clients accepted
+**              -- -1 if accept failed
+**
+** Notes:
+** Accepts up to ACCEPT_BATCH waiting connections, already
+** non-blocking, and registers each for reading. The reactor reports
+** the listener again if more are waiting. A client the reactor will
+** not take is closed again at once.
+**********************************************************************/
+int acceptClients()
+{
+    int accepted = 0;
+
+    while (accepted < ACCEPT_BATCH)
+    {
+        int newClient = accept4(workerListener, 0, 0, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if (newClient == -1)
+        {
+            //the other workers got there first, or the queue is empty
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return accepted;
+            }
+
+            //client gave up before we got to it
+            if (errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+
+            perror("accept");
+            return -1;
+        }
+
+        //set up the client's state
+        Connection *client = connections.acquire(newClient);
+        if (client == NULL)
+        {
+            close(newClient);
+            continue;
+        }
+
+        //select turns away descriptors past FD_SETSIZE
+        if (reactor->registerSocket(newClient, REACTOR_READ) == -1)
+        {
+            cerr << "Too many clients." << endl;
+            connections.release(client);
+            client->closeConnection();
+            continue;
+        }
+        client->setEvents(REACTOR_READ);
+
+        //start the client's idle clock
+        client->touch(now);
+        if (idleTimeout > 0)
+        {
+            timers.schedule(client->getTimer(), now + idleTimeout);
+        }
+
+        //count the new connection for the parent
+        reportConnected();
+        accepted++;
+
+        if (handler->onAccept(*client) == -1 || updateInterest(client) == -1)
+        {
+            closeClient(client);
+        }
+    }
+
+    return accepted;
+}
+
+/*****************************************************************
+** Function: readClient
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int readClient(Connection *client)
+**              Connection *client -- client with data waiting
+**
+** Returns:
+**			int -- returns the number of bytes read
+**              -- -1 if the client was closed
+**
+** Notes:
+** Hands what the client sent to the handler until there is no more,
+** the read budget is used up or the output queue passes the high
+** watermark, at which point reading is suspended. The reactor reports
+** the client again if there is more to read. The client is closed
+** once it hangs up, fails or the handler asks.
+**********************************************************************/
+int readClient(Connection *client)
+{
+    int socket = client->getSocketValue();
+    int numRead;
+    int totalRead = 0;
+
+    client->touch(now);
+
+    while ((numRead = recv(socket, &readBuffer[0], readBuffer.size(), 0)) > 0)
+    {
+        if (handler->onData(*client, &readBuffer[0], numRead) == -1)
+        {
+            closeClient(client);
+            return -1;
+        }
+        reportEchoed(numRead);
+        totalRead += numRead;
+
+        //stop reading until the client catches up
+        if (client->pendingOutput() >= OUTPUT_HIGH_WATERMARK)
+        {
+            client->setReadSuspended(true);
+            break;
+        }
+
+        //turn used up; the others get theirs first
+        if (readBudget > 0 && totalRead >= readBudget)
+        {
+            break;
+        }
+    }
+
+    // close socket if connection is closed by the client (therefore done)
+    if (numRead == 0 || (numRead < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+    {
+        closeClient(client);
+        return -1;
+    }
+
+    if (updateInterest(client) == -1)
+    {
+        closeClient(client);
+        return -1;
+    }
+
+    return totalRead;
+}
+
+/*****************************************************************
+** Function: spliceClient
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int spliceClient(Connection *client)
+**              Connection *client -- client with data waiting
+**
+** Returns:
+**			int -- returns the number of bytes echoed
+**              -- -1 if the client was closed
+**
+** Notes:
+** Echoes through the worker's pipe with splice() so the data never
+** crosses into user space. If the client cannot take everything, the
+** pipe is handed to the client with the rest still inside, the worker
+** takes another pipe from the pool and reading is suspended until
+** writeClient has drained the client's pipe.
+**********************************************************************/
+int spliceClient(Connection *client)
+{
+    int socket = client->getSocketValue();
+    int totalRead = 0;
+
+    client->touch(now);
+
+    while (!client->isReadSuspended())
+    {
+        if (echoPipe[0] < 0 && !pipes.acquire(echoPipe))
+        {
+            perror("pipe2");
+            closeClient(client);
+            return -1;
+        }
+
+        ssize_t numRead = splice(socket, NULL, echoPipe[1], NULL, SPLICE_CHUNK, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+        if (numRead > 0)
+        {
+            totalRead += numRead;
+            reportEchoed(numRead);
+
+            //send it straight back out of the pipe
+            ssize_t remaining = numRead;
+            while (remaining > 0)
+            {
+                ssize_t numSent = splice(echoPipe[0], NULL, socket, NULL, remaining, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+                if (numSent > 0)
+                {
+                    remaining -= numSent;
+                    continue;
+                }
+                if (numSent < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (numSent < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    //the unsent bytes are this client's; the pipe goes
+                    //with it rather than back to the next client
+                    client->attachPipe(echoPipe, remaining);
+                    echoPipe[0] = echoPipe[1] = -1;
+                    closeClient(client);
+                    return -1;
+                }
+                break;
+            }
+
+            //client is full; it keeps the pipe until it catches up
+            if (remaining > 0)
+            {
+                client->attachPipe(echoPipe, remaining);
+                client->setReadSuspended(true);
+                echoPipe[0] = echoPipe[1] = -1;
+            }
+            //turn used up; the others get theirs first
+            else if (readBudget > 0 && totalRead >= readBudget)
+            {
+                break;
+            }
+            continue;
+        }
+
+        // close socket if connection is closed by the client (therefore done)
+        if (numRead == 0)
+        {
+            closeClient(client);
+            return -1;
+        }
+
+        if (errno == EINTR)
+        {
+            continue;
+        }
+
+        //nothing left to read
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            break;
+        }
+
+        closeClient(client);
+        return -1;
+    }
+
+    if (updateInterest(client) == -1)
+    {
+        closeClient(client);
+        return -1;
+    }
+
+    return totalRead;
+}
+
+/*****************************************************************
+** Function: writeClient
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int writeClient(Connection *client)
+**              Connection *client -- client the reactor found writable
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if the client was closed
+**
+** Notes:
+** Flushes the client's queued output and resumes reading once the
+** queue has fallen to the low watermark. A splice pipe must drain
+** completely first so echoed bytes cannot be reordered. Once the
+** queue is empty the handler may send more.
+**********************************************************************/
+int writeClient(Connection *client)
+{
+    //nothing was queued; a stale report
+    if (client->pendingOutput() == 0)
+    {
+        return 0;
+    }
+
+    client->touch(now);
+
+    if (client->flushOutput() == -1)
+    {
+        closeClient(client);
+        return -1;
+    }
+
+    //a drained splice pipe goes back to the pool
+    int fds[2];
+    if (client->detachPipe(fds))
+    {
+        pipes.release(fds);
+    }
+
+    if (client->pendingOutput() == 0 && handler->onWritable(*client) == -1)
+    {
+        closeClient(client);
+        return -1;
+    }
+
+    //client has caught up; start reading again
+    if (client->isReadSuspended() && !client->hasPipe() && client->pendingOutput() <= OUTPUT_LOW_WATERMARK)
+    {
+        client->setReadSuspended(false);
+    }
+
+    if (updateInterest(client) == -1)
+    {
+        closeClient(client);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*****************************************************************
+** Function: updateInterest
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int updateInterest(Connection *client)
+**              Connection *client -- open client
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if the reactor failed
+**
+** Notes:
+** Watches the client for writing while it has output queued, and for
+** reading while reads are not suspended. Only a change reaches the
+** reactor.
+**********************************************************************/
+int updateInterest(Connection *client)
+{
+    unsigned int interest = 0;
+
+    if (!client->isReadSuspended())
+    {
+        interest |= REACTOR_READ;
+    }
+    if (client->pendingOutput() > 0)
+    {
+        interest |= REACTOR_WRITE;
+    }
+
+    //nothing changed
+    if (interest == client->getEvents())
+    {
+        return 0;
+    }
+
+    if (reactor->modifySocket(client->getSocketValue(), interest) == -1)
+    {
+        perror("Unable to change what a client is watched for");
+        return -1;
+    }
+
+    client->setEvents(interest);
+    return 0;
+}
+
+/*****************************************************************
+** Function: closeClient
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void closeClient(Connection *client)
+**              Connection *client -- client to close
+**
+** Returns:
+**			void
+**
+** Notes:
+** Lets the handler clean up, then drops the client from the reactor,
+** stops its timer, returns its record to the connection table, closes
+** it and counts it as finished.
+**********************************************************************/
+void closeClient(Connection *client)
+{
+    handler->onClose(*client);
+
+    timers.cancel(client->getTimer());
+    reactor->deregisterSocket(client->getSocketValue());
+    connections.release(client);
+    client->closeConnection();
+
+    //notify the parent that this client is finished
+    reportDone();
+}
+
+/*****************************************************************
+** Function: expireClient
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void expireClient(void *owner)
+**              void *owner -- Connection whose deadline passed
+**
+** Returns:
+**			void
+**
+** Notes:
+** Called by the timer wheel. Activity only stamps the connection, so
+** a client that was active since its timer was set is pushed back to
+** its new deadline here instead of being moved on every read.
+**********************************************************************/
+void expireClient(void *owner)
+{
+    Connection *client = (Connection *) owner;
+    unsigned long long deadline = client->getLastActive() + idleTimeout;
+
+    if (deadline > now)
+    {
+        timers.schedule(client->getTimer(), deadline);
+        return;
+    }
+
+    closeClient(client);
+}
+
+/*****************************************************************
+** Function: drainClients
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int drainClients()
+**
+** Returns:
+**			int -- number of clients still open
+**
+** Notes:
+** Closes every client with nothing in flight: no output queued, reads
+** not suspended and nothing heard from it for DRAIN_QUIET_MS, so a
+** client whose request is still on the way is not cut off. Past the
+** drain deadline every client is closed.
+**********************************************************************/
+int drainClients()
+{
+    bool expired = now >= drainDeadline;
+
+    for (int sock = 0; sock < connections.getCapacity(); sock++)
+    {
+        Connection *client = connections.lookup(sock);
+        if (client == NULL)
+        {
+            continue;
+        }
+
+        if (expired || (client->pendingOutput() == 0 && !client->isReadSuspended()
+                        && now - client->getLastActive() >= DRAIN_QUIET_MS))
+        {
+            closeClient(client);
+        }
+    }
+
+    connections.recycle();
+    return connections.getActiveCount();
+}
@@ -0,0 +1,85 @@
+#ifndef REACTORSERVER_H
+#define REACTORSERVER_H
+
+#define MIN_FREE_PROCESSES 30
+
+//most workers -w accepts
+#define MAX_WORKERS 1024
+
+#define LISTENING_PORT 9000
+#define MAX_QUEUED 1024
+
+//engine the workers wait with unless -e says otherwise
+#define DEFAULT_ENGINE "epoll"
+
+//largest epoll_wait batch a worker may grow to
+#define EPOLL_QUEUE_LEN	200000
+
+//default time between console summaries
+#define REPORT_INTERVAL_MS 1000
+
+//default bytes read from one client before the others get a turn
+#define READ_BUDGET 65536
+
+//most clients taken off the listener per wakeup
+#define ACCEPT_BATCH 64
+
+//queued output that suspends / resumes reading from a client
+#define OUTPUT_HIGH_WATERMARK 65536
+#define OUTPUT_LOW_WATERMARK 16384
+
+//most bytes moved per splice() call in the zero-copy echo
+#define SPLICE_CHUNK 65536
+
+//kernel buffer each way per socket in million-client mode (-C)
+#define C1M_SOCKET_BUFFER 4096
+
+//default seconds a client may sit idle before it is closed
+#define IDLE_TIMEOUT_SECONDS 120
+
+//default seconds a draining worker has to finish its clients
+#define DRAIN_TIMEOUT_SECONDS 30
+
+//a draining client counts as idle once it has been quiet this long
+#define DRAIN_QUIET_MS 250
+
+//time past the drain deadline before the parent kills a worker
+#define DRAIN_GRACE_MS 1000
+
+#define SOCKET_ERROR -1
+#define RETURN_ERROR -1
+#define CHILD_EXIT 0
+
+/** Parent Process functions **/
+int applyOption(int, const char *);
+void printUsage(const char *);
+int raiseFileLimit();
+int setSocketBuffers(int);
+int openListener(TCPSocket &, bool, int);
+int adoptListeners(std::vector<int> &);
+void closeListeners();
+int assignCpus(int);
+int createChildren(int);
+pid_t spawnWorker(int);
+int createThreads(int);
+int sampleStats();
+int drainWorkers();
+
+/** Worker functions **/
+void *workerThread(void *);
+int runWorker();
+int pinWorker(int);
+int reactorState();
+int waitForEvents(int);
+void controlHandler(int);
+void handleEvent(int, int);
+int acceptClients();
+int readClient(Connection *);
+int spliceClient(Connection *);
+int writeClient(Connection *);
+int updateInterest(Connection *);
+void closeClient(Connection *);
+void expireClient(void *);
+int drainClients();
+
+#endif //REACTORSERVER_H
@@ -0,0 +1,283 @@
+/**********************************************************************
+**	SOURCE FILE:	select_reactor.cpp - Reactor backend built on select
+**
+**	PROGRAM:	Scalable Server -- Reactor based
+**
+**	FUNCTIONS:
+**      SelectReactor();
+**      const char *getName();
+**      int registerSocket(int, int);
+**      int modifySocket(int, int);
+**      int deregisterSocket(int);
+**      int wait(int);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** select as a backend (-e select). The interest sets are kept up to
+** date as sockets change, and only their words up to the highest
+** descriptor watched are copied before each call; that limit drops
+** again when the socket holding it leaves. The ready sets are read
+** back a word at a time with ReadyScan (ready_scan.cpp).
+**
+** select cannot watch a descriptor of FD_SETSIZE or more, so
+** registering one fails.
+*************************************************************************/
+#include <cstring>
+#include <errno.h>
+#include "ready_scan.h"
+#include "reactor.h"
+
+using namespace std;
+
+
+/*****************************************************************
+** Function: SelectReactor
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    SelectReactor()
+**
+** Returns:
+**			void
+**
+** Notes:
+** Starts with nothing watched.
+**********************************************************************/
+SelectReactor::SelectReactor()
+{
+    FD_ZERO(&readInterest);
+    FD_ZERO(&writeInterest);
+    FD_ZERO(&readReady);
+    FD_ZERO(&writeReady);
+    maxDescriptor = -1;
+}
+
+
+/*****************************************************************
+** Function: getName
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    const char *getName()
+**
+** Returns:
+**			const char * -- name -e selects the backend by
+**
+** Notes:
+** Names the select backend.
+**********************************************************************/
+const char *SelectReactor::getName()
+{
+    return "select";
+}
+
+
+/*****************************************************************
+** Function: registerSocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int registerSocket(int sock, int interest)
+**              int sock -- socket to watch
+**              int interest -- REACTOR_* bits to watch it for
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 if the descriptor does not fit in an fd_set
+**
+** Notes:
+** Adds the socket to the interest sets.
+**********************************************************************/
+int SelectReactor::registerSocket(int sock, int interest)
+{
+    if (sock < 0 || sock >= FD_SETSIZE)
+    {
+        errno = EMFILE;
+        return -1;
+    }
+
+    if (sock > maxDescriptor)
+    {
+        maxDescriptor = sock;
+    }
+
+    return modifySocket(sock, interest);
+}
+
+
+/*****************************************************************
+** Function: modifySocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int modifySocket(int sock, int interest)
+**              int sock -- registered socket
+**              int interest -- REACTOR_* bits to watch it for now
+**
+** Returns:
+**			int -- 0
+**
+** Notes:
+** Sets the socket's bits in both interest sets.
+**********************************************************************/
+int SelectReactor::modifySocket(int sock, int interest)
+{
+    if (interest & REACTOR_READ)
+    {
+        FD_SET(sock, &readInterest);
+    }
+    else
+    {
+        FD_CLR(sock, &readInterest);
+    }
+
+    if (interest & REACTOR_WRITE)
+    {
+        FD_SET(sock, &writeInterest);
+    }
+    else
+    {
+        FD_CLR(sock, &writeInterest);
+    }
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: deregisterSocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int deregisterSocket(int sock)
+**              int sock -- registered socket
+**
+** Returns:
+**			int -- 0
+**
+** Notes:
+** Drops the socket from both sets, and finds the new highest
+** descriptor if it held the old one.
+**********************************************************************/
+int SelectReactor::deregisterSocket(int sock)
+{
+    FD_CLR(sock, &readInterest);
+    FD_CLR(sock, &writeInterest);
+
+    if (sock == maxDescriptor)
+    {
+        int highestRead = highestDescriptor(&readInterest, sock);
+        int highestWrite = highestDescriptor(&writeInterest, sock);
+
+        maxDescriptor = highestRead > highestWrite ? highestRead : highestWrite;
+    }
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: wait
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int wait(int timeout)
+**              int timeout -- most milliseconds to block, -1 for no limit
+**
+** Returns:
+**			int -- number of events collected
+**              -- -1 if select failed or was interrupted
+**
+** Notes:
+** Copies the live words of the interest sets, selects, then walks the
+** ready sets a word at a time.
+**********************************************************************/
+int SelectReactor::wait(int timeout)
+{
+    size_t liveBytes = (maxDescriptor / READY_WORD_BITS + 1) * sizeof(unsigned long);
+    struct timeval limit;
+
+    memcpy(&readReady, &readInterest, liveBytes);
+    memcpy(&writeReady, &writeInterest, liveBytes);
+
+    limit.tv_sec = timeout / 1000;
+    limit.tv_usec = (timeout % 1000) * 1000;
+
+    int numReady = select(maxDescriptor + 1, &readReady, &writeReady, NULL, timeout < 0 ? NULL : &limit);
+    if (numReady <= 0)
+    {
+        return numReady;
+    }
+
+    ReadyScan readable(&readReady, maxDescriptor);
+    ReadyScan writable(&writeReady, maxDescriptor);
+    ReactorEvent event;
+
+    while ((event.sock = readable.next()) >= 0)
+    {
+        event.events = REACTOR_READ;
+        ready.push_back(event);
+    }
+    while ((event.sock = writable.next()) >= 0)
+    {
+        event.events = REACTOR_WRITE;
+        ready.push_back(event);
+    }
+
+    return ready.size();
+}
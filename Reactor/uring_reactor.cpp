@@ -0,0 +1,487 @@
+/**********************************************************************
+**	SOURCE FILE:	uring_reactor.cpp - Reactor backend built on io_uring
+**
+**	PROGRAM:	Scalable Server -- Reactor based
+**
+**	FUNCTIONS:
+**      const char *getName();
+**      bool open();
+**      int registerSocket(int, int);
+**      int modifySocket(int, int);
+**      int deregisterSocket(int);
+**      int wait(int);
+**      struct io_uring_sqe * nextSqe();
+**      void queueArm(int);
+**      void disarm(int);
+**
+**	DATE: 		October 17th, 2026
+**
+**
+**	DESIGNER:	Rhea Lauzon A00881688
+**
+**
+**	PROGRAMMER: Rhea Lauzon A00881688
+**
+**	NOTES:
+** io_uring as a readiness backend (-e uring). Every watched socket has
+** one one-shot poll request in the ring. When it completes the socket
+** is reported and its poll queued again for the next wait, so a socket
+** that is still ready is reported again like the other backends do.
+** Changing a socket's interest removes its poll and queues a new one.
+**
+** Everything queued is submitted by the single io_uring_enter in wait,
+** which also blocks for the first completion. A wait with a limit adds
+** a timeout request that ends when the time is up or once anything
+** else has completed, whichever comes first.
+**
+** Each request carries the socket's generation, bumped whenever its
+** poll is removed, so completions for a poll that was replaced or for
+** a descriptor since reused are told apart and dropped.
+*************************************************************************/
+#include <iostream>
+#include <errno.h>
+#include "reactor.h"
+
+using namespace std;
+
+//request kinds packed into the top byte of user_data
+#define REACTOR_URING_POLL 1
+#define REACTOR_URING_REMOVE 2
+#define REACTOR_URING_TIMEOUT 3
+
+static unsigned long long packUserData(int, unsigned int, int);
+
+
+/*****************************************************************
+** Function: packUserData
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    static unsigned long long packUserData(int op, unsigned int generation, int sock)
+**              int op -- REACTOR_URING_* kind of request
+**              unsigned int generation -- the socket's generation
+**              int sock -- socket the request is for
+**
+** Returns:
+**			unsigned long long -- user_data for the submission
+**
+** Notes:
+** Tags a request the same way uring_server.cpp does.
+**********************************************************************/
+static unsigned long long packUserData(int op, unsigned int generation, int sock)
+{
+    return ((unsigned long long) op << 56) |
+           ((unsigned long long) (generation & 0xffffff) << 32) |
+           (unsigned int) sock;
+}
+
+
+/*****************************************************************
+** Function: getName
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    const char *getName()
+**
+** Returns:
+**			const char * -- name -e selects the backend by
+**
+** Notes:
+** Names the io_uring backend.
+**********************************************************************/
+const char *UringReactor::getName()
+{
+    return "uring";
+}
+
+
+/*****************************************************************
+** Function: open
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    bool open()
+**
+** Returns:
+**			bool -- true if the ring was set up
+**               -- false if the kernel refused it
+**
+** Notes:
+** Maps the ring.
+**********************************************************************/
+bool UringReactor::open()
+{
+    if (!ring.setup(REACTOR_URING_ENTRIES, REACTOR_URING_COMPLETIONS))
+    {
+        cerr << "Failed to create io_uring" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+/*****************************************************************
+** Function: registerSocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int registerSocket(int sock, int interest)
+**              int sock -- socket to watch
+**              int interest -- REACTOR_* bits to watch it for
+**
+** Returns:
+**			int -- 0 on success
+**              -- -1 for a negative descriptor
+**
+** Notes:
+** Queues the socket's first poll.
+**********************************************************************/
+int UringReactor::registerSocket(int sock, int interest)
+{
+    if (sock < 0)
+    {
+        return -1;
+    }
+
+    if (sock >= (int) watches.size())
+    {
+        UringWatch unused = UringWatch();
+        watches.resize(sock + 1, unused);
+    }
+
+    UringWatch &watch = watches[sock];
+    watch.interest = interest;
+    watch.registered = true;
+    watch.armed = false;
+    watch.generation++;
+    queueArm(sock);
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: modifySocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int modifySocket(int sock, int interest)
+**              int sock -- registered socket
+**              int interest -- REACTOR_* bits to watch it for now
+**
+** Returns:
+**			int -- 0
+**
+** Notes:
+** Replaces the socket's poll with one for the new interest.
+**********************************************************************/
+int UringReactor::modifySocket(int sock, int interest)
+{
+    UringWatch &watch = watches[sock];
+
+    if (watch.interest == interest)
+    {
+        return 0;
+    }
+
+    disarm(sock);
+    watch.interest = interest;
+    queueArm(sock);
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: deregisterSocket
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int deregisterSocket(int sock)
+**              int sock -- registered socket
+**
+** Returns:
+**			int -- 0
+**
+** Notes:
+** Removes the socket's poll. The removal goes to the kernel with the
+** next wait, before the descriptor can be reused.
+**********************************************************************/
+int UringReactor::deregisterSocket(int sock)
+{
+    disarm(sock);
+    watches[sock].registered = false;
+
+    return 0;
+}
+
+
+/*****************************************************************
+** Function: wait
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    int wait(int timeout)
+**              int timeout -- most milliseconds to block, -1 for no limit
+**
+** Returns:
+**			int -- number of events collected
+**              -- -1 if io_uring_enter failed or was interrupted
+**
+** Notes:
+** Submits the queued polls and removals, blocks for a completion and
+** collects every completion that is in.
+**********************************************************************/
+int UringReactor::wait(int timeout)
+{
+    //the timeout goes first, so polls that complete as they are
+    //submitted already end it
+    if (timeout >= 0)
+    {
+        struct io_uring_sqe *sqe = nextSqe();
+
+        waitTime.tv_sec = timeout / 1000;
+        waitTime.tv_nsec = (timeout % 1000) * 1000000LL;
+
+        sqe->opcode = IORING_OP_TIMEOUT;
+        sqe->fd = -1;
+        sqe->addr = (unsigned long long) &waitTime;
+        sqe->len = 1;
+        sqe->off = 1;
+        sqe->user_data = packUserData(REACTOR_URING_TIMEOUT, 0, 0);
+    }
+
+    for (size_t i = 0; i < arming.size(); i++)
+    {
+        int sock = arming[i];
+        UringWatch &watch = watches[sock];
+
+        watch.queued = false;
+        if (!watch.registered || watch.armed || watch.interest == 0)
+        {
+            continue;
+        }
+
+        struct io_uring_sqe *sqe = nextSqe();
+
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = sock;
+        sqe->poll32_events = ((watch.interest & REACTOR_READ) ? POLLIN : 0)
+                           | ((watch.interest & REACTOR_WRITE) ? POLLOUT : 0);
+        sqe->user_data = packUserData(REACTOR_URING_POLL, watch.generation, sock);
+        watch.armed = true;
+    }
+    arming.clear();
+
+    if (ring.submit(1) == -1 && errno != EBUSY)
+    {
+        return -1;
+    }
+
+    struct io_uring_cqe *cqe;
+    ReactorEvent event;
+
+    while ((cqe = ring.peekCompletion()) != NULL)
+    {
+        int op = cqe->user_data >> 56;
+        unsigned int generation = (cqe->user_data >> 32) & 0xffffff;
+        int sock = (int) (cqe->user_data & 0xffffffff);
+        int result = cqe->res;
+
+        ring.completionSeen();
+
+        if (op != REACTOR_URING_POLL)
+        {
+            continue;
+        }
+
+        //a poll that has since been removed or replaced
+        UringWatch &watch = watches[sock];
+        if (!watch.registered || !watch.armed || generation != (watch.generation & 0xffffff))
+        {
+            continue;
+        }
+
+        //one-shot; watch it again next time
+        watch.armed = false;
+        queueArm(sock);
+
+        //a poll the kernel would not take counts as an error on the
+        //socket, for the server's next recv or send to find
+        event.sock = sock;
+        event.events = readyFor(result < 0 ? POLLERR : result, watch.interest);
+        if (event.events != 0)
+        {
+            ready.push_back(event);
+        }
+    }
+
+    return ready.size();
+}
+
+
+/*****************************************************************
+** Function: nextSqe
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    struct io_uring_sqe * nextSqe()
+**
+** Returns:
+**			struct io_uring_sqe * -- a free submission entry
+**
+** Notes:
+** Gets a submission entry, flushing the queue to the kernel first
+** if it is full.
+**********************************************************************/
+struct io_uring_sqe * UringReactor::nextSqe()
+{
+    struct io_uring_sqe *sqe;
+
+    while ((sqe = ring.getSqe()) == NULL)
+    {
+        ring.submit(0);
+    }
+
+    return sqe;
+}
+
+
+/*****************************************************************
+** Function: queueArm
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void queueArm(int sock)
+**              int sock -- socket to poll again
+**
+** Returns:
+**			void
+**
+** Notes:
+** Has the next wait submit a poll for the socket, once.
+**********************************************************************/
+void UringReactor::queueArm(int sock)
+{
+    if (!watches[sock].queued)
+    {
+        watches[sock].queued = true;
+        arming.push_back(sock);
+    }
+}
+
+
+/*****************************************************************
+** Function: disarm
+**
+** Date: October 17th, 2026
+**
+** Revisions:
+**
+**
+** Designer: Rhea Lauzon
+**
+** Programmer: Rhea Lauzon
+**
+** Interface:
+**		    void disarm(int sock)
+**              int sock -- socket whose poll is to go
+**
+** Returns:
+**			void
+**
+** Notes:
+** Queues the removal of the socket's poll, if it has one in the ring,
+** and moves the socket to a new generation so whatever that poll
+** still reports is dropped.
+**********************************************************************/
+void UringReactor::disarm(int sock)
+{
+    UringWatch &watch = watches[sock];
+
+    if (watch.armed)
+    {
+        struct io_uring_sqe *sqe = nextSqe();
+
+        sqe->opcode = IORING_OP_POLL_REMOVE;
+        sqe->fd = -1;
+        sqe->addr = packUserData(REACTOR_URING_POLL, watch.generation, sock);
+        sqe->user_data = packUserData(REACTOR_URING_REMOVE, 0, sock);
+        watch.armed = false;
+    }
+
+    watch.generation++;
+}